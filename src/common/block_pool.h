@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+
+// Fixed-size pool of equally sized memory blocks.
+//
+// Allocations that fit a block are served from the pool in constant time and
+// without touching the heap. Bigger allocations, or allocations while the
+// pool is exhausted, fall back to the heap and are counted, so a misconfigured
+// pool shows up in the statistics rather than as a failure.
+//
+// Thread safe; blocks may be freed from a different thread than the one which
+// allocated them.
+template <size_t block_size, size_t block_count>
+class BlockPool {
+ public:
+  struct Stats {
+    uint32_t pool_allocations = 0;
+    uint32_t heap_allocations = 0;
+    uint32_t in_use = 0;
+    uint32_t high_watermark = 0;
+  };
+
+  BlockPool() {
+    for (size_t i = 0; i < block_count; i++) {
+      blocks_[i].next = (i + 1 < block_count) ? &blocks_[i + 1] : nullptr;
+    }
+    free_list_ = &blocks_[0];
+  }
+
+  BlockPool(const BlockPool&) = delete;
+  BlockPool& operator=(const BlockPool&) = delete;
+
+  void* Allocate(size_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (size <= block_size && free_list_) {
+        Block* block = free_list_;
+        free_list_ = block->next;
+        stats_.pool_allocations++;
+        stats_.in_use++;
+        if (stats_.in_use > stats_.high_watermark) {
+          stats_.high_watermark = stats_.in_use;
+        }
+        return block->storage;
+      }
+      stats_.heap_allocations++;
+    }
+    return ::operator new(size);
+  }
+
+  void Free(void* pointer) {
+    if (!Owns(pointer)) {
+      ::operator delete(pointer);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto block = reinterpret_cast<Block*>(pointer);
+    block->next = free_list_;
+    free_list_ = block;
+    stats_.in_use--;
+  }
+
+  Stats GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  union Block {
+    Block* next;
+    alignas(std::max_align_t) uint8_t storage[block_size];
+  };
+
+  std::array<Block, block_count> blocks_;
+  Block* free_list_ = nullptr;
+  Stats stats_;
+  std::mutex mutex_;
+
+  bool Owns(void* pointer) const {
+    auto address = reinterpret_cast<uintptr_t>(pointer);
+    return address >= reinterpret_cast<uintptr_t>(blocks_.data()) &&
+           address < reinterpret_cast<uintptr_t>(blocks_.data() + block_count);
+  }
+};
+
+// Standard allocator serving allocations from a BlockPool. Intended for
+// std::allocate_shared, which places object and control block in a single
+// allocation.
+template <typename T, typename Pool>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  explicit PoolAllocator(Pool& pool) : pool_(&pool) {}
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U, Pool>& other) : pool_(other.pool_) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(pool_->Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* pointer, size_t) { pool_->Free(pointer); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U, Pool>& other) const {
+    return pool_ == other.pool_;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U, Pool>& other) const {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename U, typename P>
+  friend class PoolAllocator;
+
+  Pool* pool_;
+};
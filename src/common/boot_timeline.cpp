@@ -0,0 +1,67 @@
+#include "boot_timeline.h"
+
+#include <algorithm>
+
+Logger BootTimeline::logger("boot");
+
+namespace {
+
+constexpr const char* stage_names[] = {
+    "setup",        "state",   "nfc_reader_0", "nfc_reader_1",
+    "nfc_reader_2", "machine", "display",      "ui",
+};
+static_assert(std::size(stage_names) == static_cast<size_t>(BootStage::kCount));
+
+}  // namespace
+
+BootTimeline& BootTimeline::instance() {
+  static BootTimeline timeline;
+  return timeline;
+}
+
+void BootTimeline::Mark(BootStage stage) {
+  // Uptime is never 0 once setup() runs, which keeps it apart from pending.
+  auto now = std::max<system_tick_t>(millis(), 1);
+  system_tick_t pending = 0;
+  if (!marks_[static_cast<size_t>(stage)].compare_exchange_strong(pending,
+                                                                   now)) {
+    return;
+  }
+
+  logger.info("%s after %lu ms", stage_names[static_cast<size_t>(stage)], now);
+  changed_.Notify();
+}
+
+bool BootTimeline::IsDone(BootStage stage) const {
+  return marks_[static_cast<size_t>(stage)] != 0;
+}
+
+void BootTimeline::WaitFor(BootStage stage) const {
+  auto version = changed_.Version();
+  while (!IsDone(stage)) {
+    version = changed_.WaitForChange(version, 1000);
+  }
+}
+
+bool BootTimeline::WaitFor(BootStage stage, system_tick_t timeout_ms) const {
+  auto start = millis();
+  auto version = changed_.Version();
+  while (!IsDone(stage)) {
+    auto elapsed = millis() - start;
+    if (elapsed >= timeout_ms) return false;
+    version = changed_.WaitForChange(
+        version, std::min<system_tick_t>(timeout_ms - elapsed, 1000));
+  }
+  return true;
+}
+
+String BootTimeline::ToJson() const {
+  String json = "{";
+  for (size_t i = 0; i < marks_.size(); i++) {
+    system_tick_t mark = marks_[i];
+    if (mark == 0) continue;
+    if (json.length() > 1) json += ",";
+    json += String::format("\"%s\":%lu", stage_names[i], mark);
+  }
+  return json + "}";
+}
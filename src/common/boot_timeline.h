@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "Particle.h"
+#include "common/change_signal.h"
+
+enum class BootStage : uint8_t {
+  // setup() was entered, after Device OS came up.
+  kSetup,
+  // Configuration, allowlist and metering were loaded from flash.
+  kState,
+  // The PN532 of a reader was reset and configured.
+  kNfcReader0,
+  kNfcReader1,
+  kNfcReader2,
+  kMachine,
+  // Display reset and LVGL initialized.
+  kDisplay,
+  // First frame rendered.
+  kUserInterface,
+  kCount,
+};
+
+// Uptime at which each boot stage completed.
+//
+// Independent hardware is initialized concurrently on the worker threads;
+// stages which depend on others wait for them via WaitFor(). The timeline is
+// readable as the cloud variable "boot_timeline", to track regressions of
+// the boot time.
+//
+// Thread safe.
+class BootTimeline {
+ public:
+  static BootTimeline& instance();
+
+  // Records the completion of a stage, and wakes the threads waiting for it.
+  // Later marks of the same stage are ignored.
+  void Mark(BootStage stage);
+
+  bool IsDone(BootStage stage) const;
+
+  // Blocks until the stage completed.
+  void WaitFor(BootStage stage) const;
+  // Blocks until the stage completed, for at most timeout_ms. Returns false
+  // if it did not complete in time.
+  bool WaitFor(BootStage stage, system_tick_t timeout_ms) const;
+
+  // The completed stages with their uptime in ms, e.g.
+  // {"setup":812,"state":845}.
+  String ToJson() const;
+
+ private:
+  static Logger logger;
+
+  // Uptime of each stage, 0 while it is pending.
+  std::array<std::atomic<system_tick_t>, static_cast<size_t>(BootStage::kCount)>
+      marks_ = {};
+  ChangeSignal changed_;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// Version counter which threads can block on until it is incremented.
+//
+// Notify() is cheap when nobody waits, so a signal can be shared by several
+// sources, e.g. to wake a single thread on changes of any of them.
+class ChangeSignal {
+ public:
+  ChangeSignal() = default;
+  ChangeSignal(const ChangeSignal&) = delete;
+  ChangeSignal& operator=(const ChangeSignal&) = delete;
+
+  // Starts at 0, incremented with every Notify().
+  uint32_t Version() const { return version_.load(std::memory_order_acquire); }
+
+  void Notify() {
+    {
+      // Taking the lock orders the increment against waiters that just
+      // checked the version, so no notification is lost.
+      std::lock_guard<std::mutex> lock(wait_mutex_);
+      version_.fetch_add(1, std::memory_order_release);
+    }
+    changed_.notify_all();
+  }
+
+  // Blocks until the version moved past last_version, or until timeout_ms
+  // passed. Returns the current version, which equals last_version on
+  // timeout.
+  uint32_t WaitForChange(uint32_t last_version, uint32_t timeout_ms) const {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    changed_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                      [&] { return Version() != last_version; });
+    return Version();
+  }
+
+ private:
+  std::atomic<uint32_t> version_ = 0;
+
+  mutable std::mutex wait_mutex_;
+  mutable std::condition_variable changed_;
+};
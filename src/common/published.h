@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "change_signal.h"
+
+// Publishes immutable values from one thread to any number of readers.
+//
+// Each Publish() replaces the value as a whole and increments a version
+// counter. Readers never block: Get() atomically takes a reference to the
+// current value, which stays valid (and unchanged) for as long as the reader
+// holds it. Readers that would otherwise poll can block in WaitForChange()
+// until a newer version has been published.
+template <typename T>
+class Published {
+ public:
+  explicit Published(std::shared_ptr<T> initial)
+      : value_(std::move(initial)) {}
+
+  Published(const Published&) = delete;
+  Published& operator=(const Published&) = delete;
+
+  std::shared_ptr<T> Get() const { return std::atomic_load(&value_); }
+
+  // Version of the current value, starting at 0 and incremented with every
+  // Publish().
+  uint32_t Version() const { return changes_.Version(); }
+
+  void Publish(std::shared_ptr<T> value) {
+    std::atomic_store(&value_, std::move(value));
+    changes_.Notify();
+  }
+
+  // Blocks until a version newer than last_version is published, or until
+  // timeout_ms passed. Returns the current version, which equals last_version
+  // on timeout.
+  uint32_t WaitForChange(uint32_t last_version, uint32_t timeout_ms) const {
+    return changes_.WaitForChange(last_version, timeout_ms);
+  }
+
+ private:
+  // Accessed via std::atomic_load/store only.
+  std::shared_ptr<T> value_;
+  ChangeSignal changes_;
+};
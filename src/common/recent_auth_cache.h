@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "uid_set.h"
+
+// Tokens of the sessions recently authorized by the cloud, per tag and
+// machine.
+//
+// A token is valid for a fixed window after it was stored. Holds at most
+// capacity entries; storing into a full cache evicts the oldest one. Times
+// are millis() ticks, compared by difference so they survive wrap-around.
+//
+// Not thread safe.
+template <size_t capacity>
+class RecentAuthCache {
+  static_assert(capacity > 0, "capacity must be positive");
+
+ public:
+  explicit RecentAuthCache(uint32_t window_ms) : window_ms_(window_ms) {}
+
+  // Stores the token of a session, replacing a previous one of the same tag
+  // and machine.
+  void Store(uint32_t machine_id_hash, const TagUid& uid, std::string token,
+             uint32_t now) {
+    Entry* slot = Find(machine_id_hash, uid, now);
+    if (!slot) {
+      slot = &entries_[0];
+      for (auto& entry : entries_) {
+        if (!IsValid(entry, now)) {
+          slot = &entry;
+          break;
+        }
+        if (now - entry.stored_at > now - slot->stored_at) slot = &entry;
+      }
+    }
+
+    *slot = Entry{
+        .machine_id_hash = machine_id_hash,
+        .uid = uid,
+        .token = std::move(token),
+        .stored_at = now,
+        .is_used = true,
+    };
+  }
+
+  // Returns the token of the tag's last session on the machine, if it is
+  // still within the window.
+  std::optional<std::string> Lookup(uint32_t machine_id_hash,
+                                    const TagUid& uid, uint32_t now) {
+    auto entry = Find(machine_id_hash, uid, now);
+    if (!entry) return std::nullopt;
+    return entry->token;
+  }
+
+  // Drops the token, e.g. once the cloud rejected it.
+  void Erase(uint32_t machine_id_hash, const TagUid& uid, uint32_t now) {
+    auto entry = Find(machine_id_hash, uid, now);
+    if (entry) *entry = Entry{};
+  }
+
+ private:
+  struct Entry {
+    uint32_t machine_id_hash = 0;
+    TagUid uid = {};
+    std::string token;
+    uint32_t stored_at = 0;
+    bool is_used = false;
+  };
+
+  const uint32_t window_ms_;
+  std::array<Entry, capacity> entries_;
+
+  bool IsValid(const Entry& entry, uint32_t now) const {
+    return entry.is_used && now - entry.stored_at < window_ms_;
+  }
+
+  Entry* Find(uint32_t machine_id_hash, const TagUid& uid, uint32_t now) {
+    for (auto& entry : entries_) {
+      if (IsValid(entry, now) && entry.machine_id_hash == machine_id_hash &&
+          entry.uid == uid) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+#include "uid_set.h"
+
+// Runtime of the sessions of a single machine, in whole seconds.
+//
+// Fed with the machine's current session on every update. A session counts
+// from its start until its deadline, and a session replaced by another one
+// (e.g. taken over during its timeout) stops counting at the start of its
+// replacement. The sub-second remainder carries over to the next update.
+// Times are millis() ticks.
+//
+// Not thread safe.
+class RuntimeMeter {
+ public:
+  struct Session {
+    TagUid tag_uid;
+    uint32_t started_at;
+    // End of the session, UINT32_MAX while it has none.
+    uint32_t deadline;
+  };
+
+  struct Counted {
+    // Seconds of a session counted before, which ended since the last
+    // update.
+    uint32_t ended_seconds = 0;
+    // The current session was not counted before, its runtime starts at 0.
+    bool started = false;
+    // Seconds of the current session.
+    uint32_t seconds = 0;
+  };
+
+  // Counts the runtime up to now. session is the machine's current session,
+  // if any.
+  Counted Update(const std::optional<Session>& session, uint32_t now) {
+    Counted counted;
+
+    if (tracked_ && (!session || session->tag_uid != tracked_->tag_uid ||
+                     session->started_at != tracked_->started_at)) {
+      // A removed session ended by now, a replaced one with its
+      // replacement's start.
+      auto ended_at = session ? session->started_at : now;
+      counted.ended_seconds =
+          CountUntil(std::min(ended_at, tracked_->deadline));
+      tracked_.reset();
+    }
+
+    if (!session) return counted;
+
+    if (!tracked_) {
+      tracked_ = Tracked{
+          .tag_uid = session->tag_uid,
+          .started_at = session->started_at,
+          .deadline = session->deadline,
+          .counted_until = session->started_at,
+          .remainder_ms = 0,
+      };
+      counted.started = true;
+    }
+
+    tracked_->deadline = session->deadline;
+    counted.seconds = CountUntil(std::min(now, session->deadline));
+    return counted;
+  }
+
+ private:
+  struct Tracked {
+    TagUid tag_uid;
+    uint32_t started_at;
+    uint32_t deadline;
+    uint32_t counted_until;
+    uint32_t remainder_ms;
+  };
+  std::optional<Tracked> tracked_;
+
+  uint32_t CountUntil(uint32_t until) {
+    if (static_cast<int32_t>(until - tracked_->counted_until) <= 0) return 0;
+
+    auto elapsed_ms = until - tracked_->counted_until + tracked_->remainder_ms;
+    tracked_->counted_until = until;
+    tracked_->remainder_ms = elapsed_ms % 1000;
+    return elapsed_ms / 1000;
+  }
+};
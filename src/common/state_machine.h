@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// Declares the transition of a state machine from state From to state To.
+template <typename From, typename To>
+struct Transition {};
+
+// Compile-time table of the legal transitions of a state machine, whose
+// states are the alternatives of a std::variant.
+//
+// A flow declares its transitions once, e.g.
+//
+//   using Transitions = TransitionTable<Transition<Wait, Await>,
+//                                       Transition<Await, Completed>>;
+//
+// and changes state through a helper which static_asserts
+// Transitions::Allows<From, To>(), so an undeclared transition fails to
+// compile instead of showing up on a device.
+template <typename... Transitions>
+struct TransitionTable {
+  template <typename From, typename To>
+  static constexpr bool Allows() {
+    return (std::is_same_v<Transitions, Transition<From, To>> || ...);
+  }
+};
+
+namespace state_machine_internal {
+
+template <typename Variant, typename Visitor, size_t... indices>
+decltype(auto) Dispatch(Variant &variant, Visitor &visitor,
+                        std::index_sequence<indices...>) {
+  using Result = decltype(visitor(*std::get_if<0>(&variant)));
+  using Handler = Result (*)(Variant &, Visitor &);
+
+  static constexpr Handler table[] = {
+      [](Variant &v, Visitor &f) -> Result {
+        return f(*std::get_if<indices>(&v));
+      }...};
+  return table[variant.index()](variant, visitor);
+}
+
+}  // namespace state_machine_internal
+
+// Calls visitor with the active state of variant.
+//
+// The handlers are looked up in a constexpr table indexed by
+// variant.index(), so dispatch is a single indirect call regardless of the
+// number of states. The visitor must return the same type for all states,
+// and variant must not be valueless.
+template <typename Variant, typename Visitor>
+decltype(auto) Dispatch(Variant &variant, Visitor &&visitor) {
+  return state_machine_internal::Dispatch(
+      variant, visitor,
+      std::make_index_sequence<
+          std::variant_size_v<std::remove_const_t<Variant>>>());
+}
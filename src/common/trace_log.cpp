@@ -0,0 +1,52 @@
+#include "trace_log.h"
+
+Logger TraceLog::logger("trace");
+
+TraceLog &TraceLog::instance() {
+  static TraceLog trace_log;
+  return trace_log;
+}
+
+Status TraceLog::Begin() {
+  if (thread_ != nullptr) {
+    logger.error("TraceLog::Begin() Already initialized");
+    return Status::kError;
+  }
+
+  thread_ = new Thread(
+      "TraceLog", [this]() { DrainThread(); }, config::trace::thread_priority,
+      config::trace::thread_stack_size);
+
+  return Status::kOk;
+}
+
+void TraceLog::Write(const Logger &logger, const char *format, uint32_t arg,
+                     const uint8_t *data, size_t size) {
+  if (!logger.isTraceEnabled()) return;
+
+  if (!ring_.TryPush(&logger, format, arg, millis(), data, size)) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+os_thread_return_t TraceLog::DrainThread() {
+  TraceRecord record;
+  while (true) {
+    if (auto dropped = dropped_.exchange(0, std::memory_order_relaxed)) {
+      logger.warn("Dropped %lu trace records", dropped);
+    }
+
+    while (ring_.TryPop(record)) {
+      auto message = String::format(record.format, record.arg);
+      auto data_size = record.GetDataSize();
+      // The log timestamp is the time of draining, so the time of writing is
+      // logged as well.
+      static_cast<const Logger *>(record.source)
+          ->trace("%s[%s%s] at %lu ms", message.c_str(),
+                  BytesToHexString(record.data, data_size).c_str(),
+                  data_size < record.size ? " ..." : "", record.timestamp);
+    }
+
+    delay(config::trace::drain_interval_ms);
+  }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+
+#include "common.h"
+#include "common/trace_ring.h"
+
+// Trace logging for hot paths, e.g. the PN532 frames.
+//
+// Write() only copies the format pointer, an argument and the raw bytes into
+// a lock-free ring. A low priority thread formats the records and passes
+// them on to the logger they were written for, so the caller never formats
+// or waits for the log output.
+//
+// Thread safe.
+class TraceLog {
+ public:
+  static TraceLog &instance();
+
+  // Starts the drain thread. Records written before are kept.
+  Status Begin();
+
+  // Queues a trace message for logger, if its trace level is enabled. The
+  // message is format, with arg as its only argument, followed by the data
+  // as hex, e.g. "WriteFrame(0x4a)[01 00]". format must be a string literal.
+  void Write(const Logger &logger, const char *format, uint32_t arg,
+             const uint8_t *data = nullptr, size_t size = 0);
+
+ private:
+  static Logger logger;
+
+  TraceRing<config::trace::ring_size> ring_;
+  // Records dropped while the ring was full, since the last drain.
+  std::atomic<uint32_t> dropped_ = 0;
+  Thread *thread_ = nullptr;
+
+  os_thread_return_t DrainThread();
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+// Binary trace message, formatted later by the consumer.
+struct TraceRecord {
+  static constexpr size_t max_data_size = 48;
+
+  // Producer specific, e.g. the logger to write the message to.
+  const void* source;
+  // printf format of the message, taking arg as its only argument. Must be a
+  // string literal, as only the pointer is stored.
+  const char* format;
+  uint32_t arg;
+  uint32_t timestamp;
+  // Size of the traced data, of which at most max_data_size bytes are kept.
+  uint16_t size;
+  uint8_t data[max_data_size];
+
+  size_t GetDataSize() const { return std::min<size_t>(size, max_data_size); }
+};
+
+// Bounded ring of trace records, for many producers and a single consumer.
+//
+// Producers claim a slot with a CAS on the write position and publish it via
+// the slot's sequence number, so pushing never blocks and never allocates.
+// Records are dropped while the ring is full.
+template <size_t capacity>
+class TraceRing {
+  static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                "capacity must be a power of two");
+
+ public:
+  TraceRing() {
+    for (size_t i = 0; i < capacity; i++) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  TraceRing(const TraceRing&) = delete;
+  TraceRing& operator=(const TraceRing&) = delete;
+
+  // Returns false if the ring is full. Safe to call from several threads.
+  bool TryPush(const void* source, const char* format, uint32_t arg,
+               uint32_t timestamp, const uint8_t* data, size_t size) {
+    uint32_t position = write_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+      slot = &slots_[position & (capacity - 1)];
+      uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<int32_t>(sequence - position);
+      if (diff == 0) {
+        if (write_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The consumer did not take the record of the previous round yet.
+        return false;
+      } else {
+        position = write_position_.load(std::memory_order_relaxed);
+      }
+    }
+
+    auto& record = slot->record;
+    record.source = source;
+    record.format = format;
+    record.arg = arg;
+    record.timestamp = timestamp;
+    record.size = static_cast<uint16_t>(std::min<size_t>(size, UINT16_MAX));
+    memcpy(record.data, data, record.GetDataSize());
+
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns false if there is no complete record. Only to be called from a
+  // single thread.
+  bool TryPop(TraceRecord& record) {
+    Slot& slot = slots_[read_position_ & (capacity - 1)];
+    uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (static_cast<int32_t>(sequence - (read_position_ + 1)) < 0) {
+      return false;
+    }
+
+    record = slot.record;
+    slot.sequence.store(read_position_ + capacity, std::memory_order_release);
+    read_position_++;
+    return true;
+  }
+
+ private:
+  struct Slot {
+    // Equals the write position it is free for, or that position + 1 once
+    // the record is complete.
+    std::atomic<uint32_t> sequence;
+    TraceRecord record;
+  };
+
+  Slot slots_[capacity];
+  std::atomic<uint32_t> write_position_ = 0;
+  uint32_t read_position_ = 0;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// 7-byte ISO/IEC14443 Type A UID, as used by NTAG424 tags.
+using TagUid = std::array<uint8_t, 7>;
+
+// Immutable set of tag UIDs, stored as a sorted, densely packed array.
+//
+// Lookups are a binary search over 7 byte entries, which keeps the RAM
+// footprint at exactly 7 bytes per UID (no per-node overhead) and answers in
+// a few microseconds even for thousands of entries.
+class SortedUidSet {
+ public:
+  SortedUidSet() = default;
+
+  explicit SortedUidSet(std::vector<TagUid> uids) : uids_(std::move(uids)) {
+    std::sort(uids_.begin(), uids_.end());
+    uids_.erase(std::unique(uids_.begin(), uids_.end()), uids_.end());
+    uids_.shrink_to_fit();
+  }
+
+  bool Contains(const TagUid& uid) const {
+    return std::binary_search(uids_.begin(), uids_.end(), uid);
+  }
+
+  size_t size() const { return uids_.size(); }
+
+ private:
+  std::vector<TagUid> uids_;
+};
+
+// Fixed-size Bloom filter over tag UIDs.
+//
+// Answers "definitely not in the set" or "maybe in the set". The hash_count
+// probe positions are derived from two FNV-1a hashes (Kirsch-Mitzenmacher
+// double hashing), so adding and probing never allocates.
+//
+// Template Args:
+//   bit_count: Size of the filter in bits. Must be a multiple of 8.
+//   hash_count: Number of probes per UID.
+template <size_t bit_count, size_t hash_count>
+class UidBloomFilter {
+  static_assert(bit_count % 8 == 0, "bit_count must be a multiple of 8");
+  static_assert(hash_count > 0, "hash_count must be positive");
+
+ public:
+  void Add(const TagUid& uid) {
+    auto [h1, h2] = Hash(uid);
+    for (size_t i = 0; i < hash_count; i++) {
+      size_t bit = (h1 + i * h2) % bit_count;
+      bits_[bit / 8] |= (1 << (bit % 8));
+    }
+  }
+
+  bool MayContain(const TagUid& uid) const {
+    auto [h1, h2] = Hash(uid);
+    for (size_t i = 0; i < hash_count; i++) {
+      size_t bit = (h1 + i * h2) % bit_count;
+      if ((bits_[bit / 8] & (1 << (bit % 8))) == 0) return false;
+    }
+    return true;
+  }
+
+ private:
+  std::array<uint8_t, bit_count / 8> bits_{};
+
+  static std::pair<uint32_t, uint32_t> Hash(const TagUid& uid) {
+    uint32_t h1 = 2166136261u;
+    uint32_t h2 = 2166136261u ^ 0x5bd1e995u;
+    for (auto byte : uid) {
+      h1 = (h1 ^ byte) * 16777619u;
+      h2 = (h2 ^ byte) * 16777619u;
+    }
+    // An even step would only ever probe half of the bits.
+    return {h1, h2 | 1};
+  }
+};
@@ -5,7 +5,7 @@
 #define DEVELOPMENT_BUILD 1
 #endif
 
-#include "neopixel.h"
+#include "Particle.h"
 
 enum Ntag424Key : byte;
 
@@ -18,6 +18,14 @@ constexpr os_thread_prio_t thread_priority = 3;
 // https:  // docs.lvgl.io/master/intro/introduction.html#requirements
 constexpr size_t thread_stack_size = 8 * 1024;
 
+// Time the splash screen is shown once the state is loaded. The terminal is
+// usable meanwhile.
+constexpr system_tick_t splash_screen_ms = 1500;
+
+// RAM for decoded images, e.g. the logo from the OTA assets. Least recently
+// used images are evicted beyond it.
+constexpr uint32_t image_cache_size = 48 * 1024;
+
 namespace display {
 
 constexpr auto resolution_horizontal = 240;
@@ -29,6 +37,27 @@ constexpr int8_t pin_datacommand = D10;
 constexpr int8_t pin_backlight = A5;
 constexpr int8_t pin_touch_chipselect = S3;
 constexpr int8_t pin_touch_irq = S4;
+
+// Send pixels via DMA, so LVGL renders the next chunk into the second draw
+// buffer meanwhile. Disable to compare the frame times with a blocking
+// flush.
+constexpr bool async_flush = true;
+// Interval for logging the frame time statistics.
+constexpr system_tick_t stats_interval_ms = 60 * 1000;
+
+// Raw XPT2046 readings at the edges of the screen.
+struct TouchCalibration {
+  uint16_t x_min;
+  uint16_t x_max;
+  uint16_t y_min;
+  uint16_t y_max;
+};
+constexpr TouchCalibration touch_calibration = {
+    .x_min = 220, .x_max = 3850, .y_min = 310, .y_max = 3773};
+// Minimum touch pressure, lighter touches are ignored.
+constexpr uint16_t touch_pressure_threshold = 400;
+// Samples per axis, their median is used.
+constexpr size_t touch_samples = 5;
 }  // namespace display
 
 }  // namespace ui
@@ -38,19 +67,119 @@ constexpr int8_t pin_pwm = A2;
 }  // namespace buzzer
 
 namespace led {
+// WS2812B pixels, driven via the MOSI line of SPI.
 constexpr uint8_t pixel_count = 16;
-constexpr uint8_t pixel_type = WS2812B;
+// Output value of a fully lit color channel.
+constexpr uint8_t brightness = 20;
+// Maps the color values to output values of similar perceived brightness.
+constexpr float gamma_correction = 2.6f;
+// Frame interval of fading animations. Static ones are sent once.
+constexpr system_tick_t frame_interval_ms = 20;
+
+constexpr os_thread_prio_t thread_priority = OS_THREAD_PRIORITY_DEFAULT;
+constexpr size_t thread_stack_size = OS_THREAD_STACK_SIZE_DEFAULT;
 }  // namespace led
 
 namespace nfc {
 
-constexpr int8_t pin_reset = D12;
+// A PN532 reader connected to the P2. Each reader is served by its own
+// NfcTags worker.
+struct Reader {
+  // Number of the USART the PN532 is connected to, i.e. 1 for Serial1.
+  uint8_t serial;
+  int8_t pin_reset;
+  // PN532 P70_IRQ, or -1 to poll for responses instead.
+  int8_t pin_irq;
+};
+
+// The first reader drives relais-0 via its P72, see config::machine.
+constexpr Reader readers[] = {
+    {.serial = 1, .pin_reset = D12, .pin_irq = -1},
+};
+
+// Tags listed at once by a reader, e.g. for operations requiring a member's
+// and a supervisor's tag. The PN532 handles at most 2.
+constexpr uint8_t max_targets = 2;
 
 constexpr os_thread_prio_t thread_priority = OS_THREAD_PRIORITY_DEFAULT;
 constexpr size_t thread_stack_size = OS_THREAD_STACK_SIZE_DEFAULT_HIGH;
 
+// While a tag is present, it is polled with this interval to detect its
+// removal.
+constexpr system_tick_t presence_check_interval_ms = 100;
+// Interval for logging the CPU time spent per NFC state.
+constexpr system_tick_t stats_interval_ms = 60 * 1000;
+// Maximum time a single wait for a new tag blocks the PN532. Other users of
+// the PN532 (i.e. a relay on P72) wait at most this long.
+constexpr system_tick_t tag_wait_timeout_ms = 200;
+
 }  // namespace nfc
 
+namespace machine {
+
+// P2 pin switching relais-1. relais-0 is switched via the PN532's P72.
+constexpr int8_t pin_relais_1 = A1;
+
+// Above NfcTags, so relays are switched as soon as the terminal state changes.
+constexpr os_thread_prio_t thread_priority = OS_THREAD_PRIORITY_DEFAULT + 1;
+constexpr size_t thread_stack_size = OS_THREAD_STACK_SIZE_DEFAULT;
+
+// Retry interval for a relay that failed to switch.
+constexpr system_tick_t retry_interval_ms = 100;
+// Time setup() waits for the PN532 of relais-0 to be reset, before starting
+// without relais-0.
+constexpr system_tick_t pcd_wait_timeout_ms = 2000;
+
+}  // namespace machine
+
+namespace cloud {
+
+// Queued requests published at once when replaying, see OfflineQueue.
+constexpr size_t replay_batch_size = 4;
+// Delay before a batch is replayed again after a failed publish.
+constexpr system_tick_t replay_retry_interval_ms = 30 * 1000;
+// The backend does not implement "endSession" yet, see fbs/end_session.fbs.
+// Until it does, queued requests are kept in flash (up to
+// OfflineQueue::max_log_size) instead of being replayed.
+constexpr bool replay_queued_requests = false;
+
+}  // namespace cloud
+
+namespace metering {
+
+// Runtime counters are written to flash at most this often. A power loss
+// loses the runtime counted since the last flush.
+constexpr system_tick_t flush_interval_ms = 60 * 1000;
+// The metering log is compacted beyond this size.
+constexpr uint32_t max_log_size = 4 * 1024;
+
+}  // namespace metering
+
+namespace recent_auth {
+
+// A tag re-tapped within this window after a session authorized by the cloud
+// powers the machine right away, while the cloud confirms the new session
+// with the previous session's token.
+constexpr system_tick_t window_ms = 5 * 60 * 1000;
+// Sessions remembered at once, the oldest one is dropped first.
+constexpr size_t capacity = 16;
+
+}  // namespace recent_auth
+
+namespace trace {
+
+// Trace records buffered until the drain thread formats them, see TraceLog.
+// Records are dropped while the buffer is full.
+constexpr size_t ring_size = 64;
+// The drain thread sleeps this long once the buffer is empty.
+constexpr system_tick_t drain_interval_ms = 50;
+
+// Below the workers, so formatting never delays them.
+constexpr os_thread_prio_t thread_priority = OS_THREAD_PRIORITY_DEFAULT - 1;
+constexpr size_t thread_stack_size = OS_THREAD_STACK_SIZE_DEFAULT;
+
+}  // namespace trace
+
 namespace tag {
 
 constexpr Ntag424Key key_application{0};
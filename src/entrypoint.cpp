@@ -3,6 +3,9 @@
  */
 
 #include "common.h"
+#include "common/boot_timeline.h"
+#include "common/trace_log.h"
+#include "machine/machine_controller.h"
 #include "nfc/nfc_tags.h"
 #include "state/state.h"
 #include "ui/ui.h"
@@ -14,9 +17,11 @@ SerialLogHandler logHandler(
     // Logging level for non-application messages
     LOG_LEVEL_WARN, {
                         {"app", LOG_LEVEL_ALL},
+                        {"boot", LOG_LEVEL_ALL},
                         {"cloud_request", LOG_LEVEL_ALL},
                         {"config", LOG_LEVEL_ALL},
                         {"display", LOG_LEVEL_WARN},
+                        {"machine", LOG_LEVEL_ALL},
                         {"nfc", LOG_LEVEL_ALL},
                         {"pn532", LOG_LEVEL_ALL},
                     });
@@ -24,31 +29,61 @@ SerialLogHandler logHandler(
 using namespace oww::state;
 
 std::shared_ptr<State> state_;
+// One worker per reader in config::nfc::readers.
+std::vector<std::unique_ptr<NfcTags>> nfc_readers_;
 
-void setup() {
-  Log.info("machine-auth-firmware starting");
+String GetBootTimeline() { return BootTimeline::instance().ToJson(); }
 
-  {
-    // create state_
-    state_ = std::make_shared<State>();
-    auto config = std::make_unique<Configuration>(std::weak_ptr(state_));
-    state_->Begin(std::move(config));
-  }
-
-  auto display_setup_result = oww::ui::UserInterface::instance().Begin(state_);
+void setup() {
+  BootTimeline::instance().Mark(BootStage::kSetup);
+  Particle.variable("boot_timeline", GetBootTimeline);
+  TraceLog::instance().Begin();
 
 #if defined(DEVELOPMENT_BUILD)
   // Await the terminal connections, so that all log messages during setup are
-  // not skipped.
+  // not skipped. Delays the later stages of the boot timeline.
   waitFor(Serial.isConnected, 5000);
 #endif
 
+  Log.info("machine-auth-firmware starting");
+
+  state_ = std::make_shared<State>();
+
+  // The workers reset their hardware right away, concurrently to loading the
+  // state below, and wait for the state before using it.
+  auto display_setup_result = oww::ui::UserInterface::instance().Begin(state_);
   if (!display_setup_result) {
     Log.info("Failed to start display = %d", (int)display_setup_result.error());
   }
 
-  Status nfc_setup_result = NfcTags::instance().Begin(state_);
-  Log.info("NFC Status = %d", (int)nfc_setup_result);
+  for (size_t i = 0; i < std::size(config::nfc::readers); i++) {
+    auto reader = std::make_unique<NfcTags>(i, config::nfc::readers[i]);
+    Status nfc_setup_result = reader->Begin(state_);
+    Log.info("NFC reader %d Status = %d", (int)i, (int)nfc_setup_result);
+    nfc_readers_.push_back(std::move(reader));
+  }
+
+  {
+    auto config = std::make_unique<Configuration>(std::weak_ptr(state_));
+    state_->Begin(std::move(config));
+  }
+
+  // relais-0 is driven via P72 of the first reader. The machine starts
+  // without it if that PN532 is not available.
+  std::shared_ptr<PN532> relais_0_pcd;
+  if (!BootTimeline::instance().WaitFor(
+          BootStage::kNfcReader0, config::machine::pcd_wait_timeout_ms)) {
+    Log.error("NFC reader 0 not ready, starting without relais-0");
+  } else if (nfc_readers_[0]->GetPcdStatus() != Status::kOk) {
+    Log.error("NFC reader 0 failed, starting without relais-0");
+  } else {
+    relais_0_pcd = nfc_readers_[0]->GetPcdInterface();
+  }
+
+  Status machine_setup_result =
+      oww::machine::MachineController::instance().Begin(state_, relais_0_pcd);
+  Log.info("Machine Status = %d", (int)machine_setup_result);
+  BootTimeline::instance().Mark(BootStage::kMachine);
 }
 
 void loop() { state_->Loop(); }
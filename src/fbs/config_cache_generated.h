@@ -0,0 +1,418 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_CONFIGCACHE_OWW_CONFIG_CACHE_H_
+#define FLATBUFFERS_GENERATED_CONFIGCACHE_OWW_CONFIG_CACHE_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "common.h"
+
+namespace oww {
+namespace config_cache {
+
+struct Terminal;
+struct TerminalBuilder;
+struct TerminalT;
+
+struct Machine;
+struct MachineBuilder;
+struct MachineT;
+
+struct Config;
+struct ConfigBuilder;
+struct ConfigT;
+
+struct TerminalT : public ::flatbuffers::NativeTable {
+  typedef Terminal TableType;
+  std::string machine_id{};
+  std::string label{};
+};
+
+struct Terminal FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef TerminalT NativeTableType;
+  typedef TerminalBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MACHINE_ID = 4,
+    VT_LABEL = 6
+  };
+  const ::flatbuffers::String *machine_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_MACHINE_ID);
+  }
+  const ::flatbuffers::String *label() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_LABEL);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_MACHINE_ID) &&
+           verifier.VerifyString(machine_id()) &&
+           VerifyOffset(verifier, VT_LABEL) &&
+           verifier.VerifyString(label()) &&
+           verifier.EndTable();
+  }
+  TerminalT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TerminalT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Terminal> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TerminalT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct TerminalBuilder {
+  typedef Terminal Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_machine_id(::flatbuffers::Offset<::flatbuffers::String> machine_id) {
+    fbb_.AddOffset(Terminal::VT_MACHINE_ID, machine_id);
+  }
+  void add_label(::flatbuffers::Offset<::flatbuffers::String> label) {
+    fbb_.AddOffset(Terminal::VT_LABEL, label);
+  }
+  explicit TerminalBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Terminal> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Terminal>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Terminal> CreateTerminal(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> machine_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> label = 0) {
+  TerminalBuilder builder_(_fbb);
+  builder_.add_label(label);
+  builder_.add_machine_id(machine_id);
+  return builder_.Finish();
+}
+
+struct Terminal::Traits {
+  using type = Terminal;
+  static auto constexpr Create = CreateTerminal;
+};
+
+inline ::flatbuffers::Offset<Terminal> CreateTerminalDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *machine_id = nullptr,
+    const char *label = nullptr) {
+  auto machine_id__ = machine_id ? _fbb.CreateString(machine_id) : 0;
+  auto label__ = label ? _fbb.CreateString(label) : 0;
+  return oww::config_cache::CreateTerminal(
+      _fbb,
+      machine_id__,
+      label__);
+}
+
+::flatbuffers::Offset<Terminal> CreateTerminal(::flatbuffers::FlatBufferBuilder &_fbb, const TerminalT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct MachineT : public ::flatbuffers::NativeTable {
+  typedef Machine TableType;
+  std::string machine_id{};
+  uint8_t control = 0;
+  uint32_t session_timeout_ms = 0;
+  uint8_t reader = 0;
+};
+
+struct Machine FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MachineT NativeTableType;
+  typedef MachineBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MACHINE_ID = 4,
+    VT_CONTROL = 6,
+    VT_SESSION_TIMEOUT_MS = 8,
+    VT_READER = 10
+  };
+  const ::flatbuffers::String *machine_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_MACHINE_ID);
+  }
+  uint8_t control() const {
+    return GetField<uint8_t>(VT_CONTROL, 0);
+  }
+  uint32_t session_timeout_ms() const {
+    return GetField<uint32_t>(VT_SESSION_TIMEOUT_MS, 0);
+  }
+  uint8_t reader() const {
+    return GetField<uint8_t>(VT_READER, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_MACHINE_ID) &&
+           verifier.VerifyString(machine_id()) &&
+           VerifyField<uint8_t>(verifier, VT_CONTROL, 1) &&
+           VerifyField<uint32_t>(verifier, VT_SESSION_TIMEOUT_MS, 4) &&
+           VerifyField<uint8_t>(verifier, VT_READER, 1) &&
+           verifier.EndTable();
+  }
+  MachineT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(MachineT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Machine> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MachineT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct MachineBuilder {
+  typedef Machine Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_machine_id(::flatbuffers::Offset<::flatbuffers::String> machine_id) {
+    fbb_.AddOffset(Machine::VT_MACHINE_ID, machine_id);
+  }
+  void add_control(uint8_t control) {
+    fbb_.AddElement<uint8_t>(Machine::VT_CONTROL, control, 0);
+  }
+  void add_session_timeout_ms(uint32_t session_timeout_ms) {
+    fbb_.AddElement<uint32_t>(Machine::VT_SESSION_TIMEOUT_MS, session_timeout_ms, 0);
+  }
+  void add_reader(uint8_t reader) {
+    fbb_.AddElement<uint8_t>(Machine::VT_READER, reader, 0);
+  }
+  explicit MachineBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Machine> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Machine>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Machine> CreateMachine(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> machine_id = 0,
+    uint8_t control = 0,
+    uint32_t session_timeout_ms = 0,
+    uint8_t reader = 0) {
+  MachineBuilder builder_(_fbb);
+  builder_.add_session_timeout_ms(session_timeout_ms);
+  builder_.add_machine_id(machine_id);
+  builder_.add_reader(reader);
+  builder_.add_control(control);
+  return builder_.Finish();
+}
+
+struct Machine::Traits {
+  using type = Machine;
+  static auto constexpr Create = CreateMachine;
+};
+
+inline ::flatbuffers::Offset<Machine> CreateMachineDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *machine_id = nullptr,
+    uint8_t control = 0,
+    uint32_t session_timeout_ms = 0,
+    uint8_t reader = 0) {
+  auto machine_id__ = machine_id ? _fbb.CreateString(machine_id) : 0;
+  return oww::config_cache::CreateMachine(
+      _fbb,
+      machine_id__,
+      control,
+      session_timeout_ms,
+      reader);
+}
+
+::flatbuffers::Offset<Machine> CreateMachine(::flatbuffers::FlatBufferBuilder &_fbb, const MachineT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ConfigT : public ::flatbuffers::NativeTable {
+  typedef Config TableType;
+  std::unique_ptr<oww::config_cache::TerminalT> terminal{};
+  std::vector<std::unique_ptr<oww::config_cache::MachineT>> machine{};
+  ConfigT() = default;
+  ConfigT(const ConfigT &o);
+  ConfigT(ConfigT&&) FLATBUFFERS_NOEXCEPT = default;
+  ConfigT &operator=(ConfigT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct Config FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ConfigT NativeTableType;
+  typedef ConfigBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TERMINAL = 4,
+    VT_MACHINE = 6
+  };
+  const oww::config_cache::Terminal *terminal() const {
+    return GetPointer<const oww::config_cache::Terminal *>(VT_TERMINAL);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<oww::config_cache::Machine>> *machine() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<oww::config_cache::Machine>> *>(VT_MACHINE);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_TERMINAL) &&
+           verifier.VerifyTable(terminal()) &&
+           VerifyOffset(verifier, VT_MACHINE) &&
+           verifier.VerifyVector(machine()) &&
+           verifier.VerifyVectorOfTables(machine()) &&
+           verifier.EndTable();
+  }
+  ConfigT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ConfigT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<Config> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ConfigT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ConfigBuilder {
+  typedef Config Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_terminal(::flatbuffers::Offset<oww::config_cache::Terminal> terminal) {
+    fbb_.AddOffset(Config::VT_TERMINAL, terminal);
+  }
+  void add_machine(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<oww::config_cache::Machine>>> machine) {
+    fbb_.AddOffset(Config::VT_MACHINE, machine);
+  }
+  explicit ConfigBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Config> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Config>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Config> CreateConfig(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<oww::config_cache::Terminal> terminal = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<oww::config_cache::Machine>>> machine = 0) {
+  ConfigBuilder builder_(_fbb);
+  builder_.add_machine(machine);
+  builder_.add_terminal(terminal);
+  return builder_.Finish();
+}
+
+struct Config::Traits {
+  using type = Config;
+  static auto constexpr Create = CreateConfig;
+};
+
+inline ::flatbuffers::Offset<Config> CreateConfigDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<oww::config_cache::Terminal> terminal = 0,
+    const std::vector<::flatbuffers::Offset<oww::config_cache::Machine>> *machine = nullptr) {
+  auto machine__ = machine ? _fbb.CreateVector<::flatbuffers::Offset<oww::config_cache::Machine>>(*machine) : 0;
+  return oww::config_cache::CreateConfig(
+      _fbb,
+      terminal,
+      machine__);
+}
+
+::flatbuffers::Offset<Config> CreateConfig(::flatbuffers::FlatBufferBuilder &_fbb, const ConfigT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline TerminalT *Terminal::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<TerminalT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Terminal::UnPackTo(TerminalT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = machine_id(); if (_e) _o->machine_id = _e->str(); }
+  { auto _e = label(); if (_e) _o->label = _e->str(); }
+}
+
+inline ::flatbuffers::Offset<Terminal> Terminal::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TerminalT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateTerminal(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<Terminal> CreateTerminal(::flatbuffers::FlatBufferBuilder &_fbb, const TerminalT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const TerminalT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _machine_id = _o->machine_id.empty() ? 0 : _fbb.CreateString(_o->machine_id);
+  auto _label = _o->label.empty() ? 0 : _fbb.CreateString(_o->label);
+  return oww::config_cache::CreateTerminal(
+      _fbb,
+      _machine_id,
+      _label);
+}
+
+inline MachineT *Machine::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<MachineT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Machine::UnPackTo(MachineT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = machine_id(); if (_e) _o->machine_id = _e->str(); }
+  { auto _e = control(); _o->control = _e; }
+  { auto _e = session_timeout_ms(); _o->session_timeout_ms = _e; }
+  { auto _e = reader(); _o->reader = _e; }
+}
+
+inline ::flatbuffers::Offset<Machine> Machine::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MachineT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateMachine(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<Machine> CreateMachine(::flatbuffers::FlatBufferBuilder &_fbb, const MachineT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const MachineT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _machine_id = _o->machine_id.empty() ? 0 : _fbb.CreateString(_o->machine_id);
+  auto _control = _o->control;
+  auto _session_timeout_ms = _o->session_timeout_ms;
+  auto _reader = _o->reader;
+  return oww::config_cache::CreateMachine(
+      _fbb,
+      _machine_id,
+      _control,
+      _session_timeout_ms,
+      _reader);
+}
+
+inline ConfigT::ConfigT(const ConfigT &o)
+      : terminal((o.terminal) ? new oww::config_cache::TerminalT(*o.terminal) : nullptr) {
+  machine.reserve(o.machine.size());
+  for (const auto &machine_ : o.machine) { machine.emplace_back((machine_) ? new oww::config_cache::MachineT(*machine_) : nullptr); }
+}
+
+inline ConfigT &ConfigT::operator=(ConfigT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(terminal, o.terminal);
+  std::swap(machine, o.machine);
+  return *this;
+}
+
+inline ConfigT *Config::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<ConfigT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Config::UnPackTo(ConfigT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = terminal(); if (_e) { if(_o->terminal) { _e->UnPackTo(_o->terminal.get(), _resolver); } else { _o->terminal = std::unique_ptr<oww::config_cache::TerminalT>(_e->UnPack(_resolver)); } } else if (_o->terminal) { _o->terminal.reset(); } }
+  { auto _e = machine(); if (_e) { _o->machine.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->machine[_i]) { _e->Get(_i)->UnPackTo(_o->machine[_i].get(), _resolver); } else { _o->machine[_i] = std::unique_ptr<oww::config_cache::MachineT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->machine.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<Config> Config::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ConfigT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateConfig(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<Config> CreateConfig(::flatbuffers::FlatBufferBuilder &_fbb, const ConfigT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ConfigT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _terminal = _o->terminal ? CreateTerminal(_fbb, _o->terminal.get(), _rehasher) : 0;
+  auto _machine = _o->machine.size() ? _fbb.CreateVector<::flatbuffers::Offset<oww::config_cache::Machine>> (_o->machine.size(), [](size_t i, _VectorArgs *__va) { return CreateMachine(*__va->__fbb, __va->__o->machine[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return oww::config_cache::CreateConfig(
+      _fbb,
+      _terminal,
+      _machine);
+}
+
+}  // namespace config_cache
+}  // namespace oww
+
+#endif  // FLATBUFFERS_GENERATED_CONFIGCACHE_OWW_CONFIG_CACHE_H_
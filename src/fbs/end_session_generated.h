@@ -0,0 +1,193 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ENDSESSION_OWW_SESSION_H_
+#define FLATBUFFERS_GENERATED_ENDSESSION_OWW_SESSION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "ntag_generated.h"
+
+#include "common.h"
+
+namespace oww {
+namespace session {
+
+struct EndSessionRequest;
+struct EndSessionRequestBuilder;
+struct EndSessionRequestT;
+
+struct EndSessionRequestT : public ::flatbuffers::NativeTable {
+  typedef EndSessionRequest TableType;
+  std::string session_id{};
+  uint32_t duration_ms = 0;
+  std::unique_ptr<oww::ntag::TagUid> token_id{};
+  std::string machine_id{};
+  EndSessionRequestT() = default;
+  EndSessionRequestT(const EndSessionRequestT &o);
+  EndSessionRequestT(EndSessionRequestT&&) FLATBUFFERS_NOEXCEPT = default;
+  EndSessionRequestT &operator=(EndSessionRequestT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct EndSessionRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EndSessionRequestT NativeTableType;
+  typedef EndSessionRequestBuilder Builder;
+  struct Traits;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SESSION_ID = 4,
+    VT_DURATION_MS = 6,
+    VT_TOKEN_ID = 8,
+    VT_MACHINE_ID = 10
+  };
+  const ::flatbuffers::String *session_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SESSION_ID);
+  }
+  uint32_t duration_ms() const {
+    return GetField<uint32_t>(VT_DURATION_MS, 0);
+  }
+  const oww::ntag::TagUid *token_id() const {
+    return GetStruct<const oww::ntag::TagUid *>(VT_TOKEN_ID);
+  }
+  const ::flatbuffers::String *machine_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_MACHINE_ID);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SESSION_ID) &&
+           verifier.VerifyString(session_id()) &&
+           VerifyField<uint32_t>(verifier, VT_DURATION_MS, 4) &&
+           VerifyField<oww::ntag::TagUid>(verifier, VT_TOKEN_ID, 1) &&
+           VerifyOffset(verifier, VT_MACHINE_ID) &&
+           verifier.VerifyString(machine_id()) &&
+           verifier.EndTable();
+  }
+  EndSessionRequestT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EndSessionRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<EndSessionRequest> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EndSessionRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EndSessionRequestBuilder {
+  typedef EndSessionRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_session_id(::flatbuffers::Offset<::flatbuffers::String> session_id) {
+    fbb_.AddOffset(EndSessionRequest::VT_SESSION_ID, session_id);
+  }
+  void add_duration_ms(uint32_t duration_ms) {
+    fbb_.AddElement<uint32_t>(EndSessionRequest::VT_DURATION_MS, duration_ms, 0);
+  }
+  void add_token_id(const oww::ntag::TagUid *token_id) {
+    fbb_.AddStruct(EndSessionRequest::VT_TOKEN_ID, token_id);
+  }
+  void add_machine_id(::flatbuffers::Offset<::flatbuffers::String> machine_id) {
+    fbb_.AddOffset(EndSessionRequest::VT_MACHINE_ID, machine_id);
+  }
+  explicit EndSessionRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<EndSessionRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<EndSessionRequest>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<EndSessionRequest> CreateEndSessionRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> session_id = 0,
+    uint32_t duration_ms = 0,
+    const oww::ntag::TagUid *token_id = nullptr,
+    ::flatbuffers::Offset<::flatbuffers::String> machine_id = 0) {
+  EndSessionRequestBuilder builder_(_fbb);
+  builder_.add_machine_id(machine_id);
+  builder_.add_token_id(token_id);
+  builder_.add_duration_ms(duration_ms);
+  builder_.add_session_id(session_id);
+  return builder_.Finish();
+}
+
+struct EndSessionRequest::Traits {
+  using type = EndSessionRequest;
+  static auto constexpr Create = CreateEndSessionRequest;
+};
+
+inline ::flatbuffers::Offset<EndSessionRequest> CreateEndSessionRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *session_id = nullptr,
+    uint32_t duration_ms = 0,
+    const oww::ntag::TagUid *token_id = nullptr,
+    const char *machine_id = nullptr) {
+  auto session_id__ = session_id ? _fbb.CreateString(session_id) : 0;
+  auto machine_id__ = machine_id ? _fbb.CreateString(machine_id) : 0;
+  return oww::session::CreateEndSessionRequest(
+      _fbb,
+      session_id__,
+      duration_ms,
+      token_id,
+      machine_id__);
+}
+
+::flatbuffers::Offset<EndSessionRequest> CreateEndSessionRequest(::flatbuffers::FlatBufferBuilder &_fbb, const EndSessionRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline EndSessionRequestT::EndSessionRequestT(const EndSessionRequestT &o)
+      : session_id(o.session_id),
+        duration_ms(o.duration_ms),
+        token_id((o.token_id) ? new oww::ntag::TagUid(*o.token_id) : nullptr),
+        machine_id(o.machine_id) {
+}
+
+inline EndSessionRequestT &EndSessionRequestT::operator=(EndSessionRequestT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(session_id, o.session_id);
+  std::swap(duration_ms, o.duration_ms);
+  std::swap(token_id, o.token_id);
+  std::swap(machine_id, o.machine_id);
+  return *this;
+}
+
+inline EndSessionRequestT *EndSessionRequest::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::make_unique<EndSessionRequestT>();
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void EndSessionRequest::UnPackTo(EndSessionRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = session_id(); if (_e) _o->session_id = _e->str(); }
+  { auto _e = duration_ms(); _o->duration_ms = _e; }
+  { auto _e = token_id(); if (_e) _o->token_id = std::unique_ptr<oww::ntag::TagUid>(new oww::ntag::TagUid(*_e)); }
+  { auto _e = machine_id(); if (_e) _o->machine_id = _e->str(); }
+}
+
+inline ::flatbuffers::Offset<EndSessionRequest> EndSessionRequest::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EndSessionRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateEndSessionRequest(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<EndSessionRequest> CreateEndSessionRequest(::flatbuffers::FlatBufferBuilder &_fbb, const EndSessionRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const EndSessionRequestT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _session_id = _o->session_id.empty() ? 0 : _fbb.CreateString(_o->session_id);
+  auto _duration_ms = _o->duration_ms;
+  auto _token_id = _o->token_id ? _o->token_id.get() : nullptr;
+  auto _machine_id = _o->machine_id.empty() ? 0 : _fbb.CreateString(_o->machine_id);
+  return oww::session::CreateEndSessionRequest(
+      _fbb,
+      _session_id,
+      _duration_ms,
+      _token_id,
+      _machine_id);
+}
+
+}  // namespace session
+}  // namespace oww
+
+#endif  // FLATBUFFERS_GENERATED_ENDSESSION_OWW_SESSION_H_
@@ -0,0 +1,22 @@
+#include "gpio_relay.h"
+
+namespace oww::machine {
+
+GpioRelay::GpioRelay(int8_t pin, bool active_low)
+    : pin_(pin), active_low_(active_low) {}
+
+Status GpioRelay::Begin() {
+  // Set the level before enabling the output, to not glitch the relay.
+  Set(false);
+  pinMode(pin_, OUTPUT);
+
+  return Status::kOk;
+}
+
+Status GpioRelay::Set(bool energized) {
+  digitalWrite(pin_, energized != active_low_ ? HIGH : LOW);
+
+  return Status::kOk;
+}
+
+}  // namespace oww::machine
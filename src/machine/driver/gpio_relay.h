@@ -0,0 +1,24 @@
+#pragma once
+
+#include "relay.h"
+
+namespace oww::machine {
+
+// Relay driven by a P2 GPIO pin.
+class GpioRelay : public Relay {
+ public:
+  // Args:
+  //   pin: P2 pin connected to the relay driver.
+  //   active_low: The relay is energized while the pin is LOW.
+  GpioRelay(int8_t pin, bool active_low = false);
+
+  virtual Status Begin() override;
+
+  virtual Status Set(bool energized) override;
+
+ private:
+  const int8_t pin_;
+  const bool active_low_;
+};
+
+}  // namespace oww::machine
@@ -0,0 +1,37 @@
+#include "pn532_relay.h"
+
+namespace oww::machine {
+
+Logger Pn532Relay::logger("machine");
+
+Pn532Relay::Pn532Relay(std::shared_ptr<PN532> pcd_interface)
+    : pcd_interface_(pcd_interface) {}
+
+Status Pn532Relay::Begin() {
+  // Set the level before enabling the output, to not glitch the relay.
+  Status status = Set(false);
+  if (status != Status::kOk) return status;
+
+  auto configure_gpio = pcd_interface_->ConfigureGpio72();
+  if (!configure_gpio) {
+    logger.error("Configuring PN532 P72 failed (error: %d)",
+                 (int)configure_gpio.error());
+    return Status::kError;
+  }
+
+  return Status::kOk;
+}
+
+Status Pn532Relay::Set(bool energized) {
+  auto set_gpio = pcd_interface_->SetGpio72(energized);
+  if (!set_gpio) {
+    logger.error("Setting PN532 P72 failed (error: %d)",
+                 (int)set_gpio.error());
+    return set_gpio.error() == PN532Error::kTimeout ? Status::kTimeout
+                                                    : Status::kError;
+  }
+
+  return Status::kOk;
+}
+
+}  // namespace oww::machine
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "nfc/driver/PN532.h"
+#include "relay.h"
+
+namespace oww::machine {
+
+// Relay driven by the PN532's P72 GPIO.
+//
+// The PN532 is shared with NfcTags, so switching waits for a pending NFC
+// command to complete.
+class Pn532Relay : public Relay {
+ public:
+  Pn532Relay(std::shared_ptr<PN532> pcd_interface);
+
+  virtual Status Begin() override;
+
+  virtual Status Set(bool energized) override;
+
+ private:
+  static Logger logger;
+
+  std::shared_ptr<PN532> pcd_interface_;
+};
+
+}  // namespace oww::machine
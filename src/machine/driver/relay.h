@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../../common.h"
+
+namespace oww::machine {
+
+// Output switching the power of a machine.
+class Relay {
+ public:
+  virtual ~Relay() = default;
+
+  // Configures the output and de-energizes the relay.
+  virtual Status Begin() = 0;
+
+  virtual Status Set(bool energized) = 0;
+};
+
+}  // namespace oww::machine
@@ -0,0 +1,143 @@
+#include "machine_controller.h"
+
+#include "../config.h"
+#include "../state/configuration.h"
+#include "driver/gpio_relay.h"
+#include "driver/pn532_relay.h"
+
+namespace oww::machine {
+
+using namespace config::machine;
+using oww::state::MachineControl;
+
+Logger MachineController::logger("machine");
+
+MachineController *MachineController::instance_;
+
+MachineController &MachineController::instance() {
+  if (!instance_) {
+    instance_ = new MachineController();
+  }
+  return *instance_;
+}
+
+MachineController::MachineController() {}
+
+MachineController::~MachineController() {}
+
+Status MachineController::Begin(std::shared_ptr<oww::state::State> state,
+                                std::shared_ptr<PN532> pcd_interface) {
+  if (thread_ != nullptr) {
+    logger.error("MachineController::Begin() Already initialized");
+    return Status::kError;
+  }
+
+  state_ = state;
+
+  if (pcd_interface) {
+    relays_[static_cast<size_t>(MachineControl::kRelais0)] =
+        std::make_unique<Pn532Relay>(pcd_interface);
+  }
+  relays_[static_cast<size_t>(MachineControl::kRelais1)] =
+      std::make_unique<GpioRelay>(pin_relais_1);
+
+  for (size_t i = 0; i < relays_.size(); i++) {
+    if (relays_[i] && relays_[i]->Begin() != Status::kOk) {
+      logger.error("Initialization of relay %d failed", (int)i);
+      relays_[i] = nullptr;
+    }
+  }
+
+  os_mutex_create(&mutex_);
+
+  thread_ = new Thread(
+      "MachineController", [this]() { MachineThread(); }, thread_priority,
+      thread_stack_size);
+
+  return Status::kOk;
+}
+
+os_thread_return_t MachineController::MachineThread() {
+  auto sessions_version = state_->GetMachineSessionsVersion();
+  auto time_till_update = UpdateRelays(sessions_version, micros());
+
+  while (true) {
+    // Session timeouts and relays which failed to switch are handled even
+    // without a session change.
+    sessions_version = state_->WaitForMachineSessionsChange(
+        sessions_version, time_till_update);
+    time_till_update = UpdateRelays(sessions_version, micros());
+  }
+}
+
+system_tick_t MachineController::UpdateRelays(uint32_t sessions_version,
+                                              uint32_t observed_us) {
+  auto now = millis();
+  system_tick_t time_till_update = CONCURRENT_WAIT_FOREVER;
+
+  std::array<bool, relay_count> energize = {};
+  auto sessions = state_->GetMachineSessions();
+  for (auto &session : *sessions) {
+    if (!session || !session->IsActive(now)) continue;
+
+    auto relay = static_cast<size_t>(session->machine->control);
+    if (!relays_[relay]) {
+      logger.error("Relay %d is not available", (int)relay);
+      continue;
+    }
+    energize[relay] = true;
+
+    if (session->deadline != CONCURRENT_WAIT_FOREVER) {
+      time_till_update = std::min(time_till_update, session->deadline - now);
+    }
+  }
+
+  for (size_t i = 0; i < relays_.size(); i++) {
+    if (!relays_[i] || energized_[i] == energize[i]) continue;
+
+    if (relays_[i]->Set(energize[i]) != Status::kOk) {
+      time_till_update = std::min(time_till_update, retry_interval_ms);
+      continue;
+    }
+
+    energized_[i] = energize[i];
+    RecordRelayEvent(RelayEvent{
+        .relay = static_cast<MachineControl>(i),
+        .energized = energize[i],
+        .sessions_version = sessions_version,
+        .observed_us = observed_us,
+        .switched_us = micros(),
+    });
+  }
+
+  return time_till_update;
+}
+
+void MachineController::RecordRelayEvent(const RelayEvent &event) {
+  logger.info("Relay %d %s within %lu us (sessions version %lu)",
+              (int)event.relay, event.energized ? "energized" : "released",
+              event.switched_us - event.observed_us, event.sessions_version);
+
+  os_mutex_lock(mutex_);
+  relay_events_[relay_event_next_] = event;
+  relay_event_next_ = (relay_event_next_ + 1) % relay_events_.size();
+  relay_event_size_ = std::min(relay_event_size_ + 1, relay_events_.size());
+  os_mutex_unlock(mutex_);
+}
+
+std::vector<RelayEvent> MachineController::GetRelayEvents() {
+  std::vector<RelayEvent> events;
+  events.reserve(relay_event_count);
+
+  os_mutex_lock(mutex_);
+  auto first = (relay_event_next_ + relay_events_.size() - relay_event_size_) %
+               relay_events_.size();
+  for (size_t i = 0; i < relay_event_size_; i++) {
+    events.push_back(relay_events_[(first + i) % relay_events_.size()]);
+  }
+  os_mutex_unlock(mutex_);
+
+  return events;
+}
+
+}  // namespace oww::machine
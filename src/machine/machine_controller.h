@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../common.h"
+#include "../state/state.h"
+#include "driver/relay.h"
+#include "nfc/driver/PN532.h"
+
+namespace oww::machine {
+
+// Timestamps of a relay switch, to audit the latency between a machine
+// session change and the machine being (de-)energized.
+struct RelayEvent {
+  oww::state::MachineControl relay;
+  bool energized;
+  // Machine sessions version that caused the switch.
+  uint32_t sessions_version;
+  // micros() when the session change was observed.
+  uint32_t observed_us;
+  // micros() when the relay driver completed switching.
+  uint32_t switched_us;
+};
+
+// Switches the machine relays according to the machine sessions.
+//
+// Runs in its own thread, which wakes up on every session change and when
+// a session timeout expires.
+// It runs at a higher priority than NfcTags, so relays are switched right
+// away and not just between two NFC operations.
+class MachineController {
+ public:
+  static MachineController &instance();
+
+  // Args:
+  //   state: The state whose machine sessions to follow.
+  //   pcd_interface: The PN532 driving relais-0 via P72, nullptr to run
+  //     without relais-0.
+  Status Begin(std::shared_ptr<oww::state::State> state,
+               std::shared_ptr<PN532> pcd_interface);
+
+  // Returns the most recent relay switches, oldest first.
+  std::vector<RelayEvent> GetRelayEvents();
+
+ private:
+  // MachineController is a singleton - use MachineController.instance()
+  static MachineController *instance_;
+  MachineController();
+
+  virtual ~MachineController();
+  MachineController(const MachineController &) = delete;
+  MachineController &operator=(const MachineController &) = delete;
+
+  static Logger logger;
+  Thread *thread_ = nullptr;
+  os_mutex_t mutex_ = 0;
+
+  os_thread_return_t MachineThread();
+
+  // Switches the relays to match the current machine sessions. Returns the
+  // time until the relays need to be updated again, i.e. the next session
+  // timeout or the retry interval if a relay failed to switch.
+  system_tick_t UpdateRelays(uint32_t sessions_version, uint32_t observed_us);
+
+  void RecordRelayEvent(const RelayEvent &event);
+
+ private:
+  static constexpr size_t relay_count = 3;
+  static constexpr size_t relay_event_count = 16;
+
+  std::shared_ptr<oww::state::State> state_ = nullptr;
+
+  // Relays indexed by MachineControl, nullptr if not available.
+  std::array<std::unique_ptr<Relay>, relay_count> relays_;
+  std::array<bool, relay_count> energized_ = {};
+
+  // Ring buffer of the most recent relay switches.
+  std::array<RelayEvent, relay_event_count> relay_events_;
+  size_t relay_event_next_ = 0;
+  size_t relay_event_size_ = 0;
+};
+
+}  // namespace oww::machine
@@ -6,9 +6,7 @@
 
 #include "Ntag424.h"
 
-CBC<AES128> cbc;
-AESTiny128 aes128;
-AES_CMAC cmac(aes128);
+#include "PN532.h"
 
 byte CC_FILE_AT_DELIVERY[32] = {0x00, 0x17, 0x20, 0x01, 0x00, 0x00, 0xFF, 0x04,
                                 0x06, 0xE1, 0x04, 0x01, 0x00, 0x00, 0x00, 0x05,
@@ -190,10 +188,10 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2First(byte keyNumber,
 
   byte iv[16] = {0};
   byte decryptedRndB[16];
-  cbc.setKey(key, 16);
-  cbc.setIV(iv, 16);
+  cbc_.setKey(key, 16);
+  cbc_.setIV(iv, 16);
 
-  cbc.decrypt(decryptedRndB, backData, 16);
+  cbc_.decrypt(decryptedRndB, backData, 16);
 
   byte shiftedRndB[16];
 
@@ -208,8 +206,8 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2First(byte keyNumber,
   memcpy(&inData[16], shiftedRndB, 16);
 
   byte inDataEncrypted[32];
-  cbc.setIV(iv, 16);
-  cbc.encrypt(inDataEncrypted, inData, 32);
+  cbc_.setIV(iv, 16);
+  cbc_.encrypt(inDataEncrypted, inData, 32);
 
   backLen = 61;
   statusCode =
@@ -226,8 +224,8 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2First(byte keyNumber,
   if (backLen != 34) return DNA_WRONG_RESPONSE_LEN;
 
   byte decryptedPart2[32];
-  cbc.setIV(iv, 16);
-  cbc.decrypt(decryptedPart2, backData, 32);
+  cbc_.setIV(iv, 16);
+  cbc_.decrypt(decryptedPart2, backData, 32);
 
   // compare sent RndA with received RndA'
   for (byte i = 0; i < 15; i++) {
@@ -266,10 +264,10 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2NonFirst(byte keyNumber,
 
   byte iv[16] = {0};
   byte decryptedRndB[16];
-  cbc.setKey(key, 16);
-  cbc.setIV(iv, 16);
+  cbc_.setKey(key, 16);
+  cbc_.setIV(iv, 16);
 
-  cbc.decrypt(decryptedRndB, backData, 16);
+  cbc_.decrypt(decryptedRndB, backData, 16);
 
   byte shiftedRndB[16];
 
@@ -284,8 +282,8 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2NonFirst(byte keyNumber,
   memcpy(&inData[16], shiftedRndB, 16);
 
   byte inDataEncrypted[32];
-  cbc.setIV(iv, 16);
-  cbc.encrypt(inDataEncrypted, inData, 32);
+  cbc_.setIV(iv, 16);
+  cbc_.encrypt(inDataEncrypted, inData, 32);
 
   backLen = 61;
   statusCode =
@@ -299,8 +297,8 @@ Ntag424::DNA_StatusCode Ntag424::DNA_AuthenticateEV2NonFirst(byte keyNumber,
   if (backLen != 18) return DNA_WRONG_RESPONSE_LEN;
 
   byte decryptedPart2[16];
-  cbc.setIV(iv, 16);
-  cbc.decrypt(decryptedPart2, backData, 16);
+  cbc_.setIV(iv, 16);
+  cbc_.decrypt(decryptedPart2, backData, 16);
 
   // compare sent RndA with received RndA'
   for (byte i = 0; i < 15; i++) {
@@ -1199,9 +1197,9 @@ Ntag424::DNA_StatusCode Ntag424::DNA_Full_GetCardUID(byte* backUID_7B) {
   byte IVResp[16];
   DNA_CalculateIVResp(IVResp);
 
-  cbc.setKey(SesAuthEncKey, 16);
-  cbc.setIV(IVResp, 16);
-  cbc.decrypt(backDataDecrypted, backData, 16);
+  cbc_.setKey(SesAuthEncKey, 16);
+  cbc_.setIV(IVResp, 16);
+  cbc_.decrypt(backDataDecrypted, backData, 16);
 
   if (DNA_CheckResponseCMACtWithData(backData, 16, &backData[16]) ==
       DNA_WRONG_RESPONSE_CMAC)
@@ -1249,9 +1247,9 @@ Ntag424::DNA_StatusCode Ntag424::DNA_Full_GetFileCounters(
   byte IVResp[16];
   DNA_CalculateIVResp(IVResp);
 
-  cbc.setKey(SesAuthEncKey, 16);
-  cbc.setIV(IVResp, 16);
-  cbc.decrypt(backDataDecrypted, backData, 16);
+  cbc_.setKey(SesAuthEncKey, 16);
+  cbc_.setIV(IVResp, 16);
+  cbc_.decrypt(backDataDecrypted, backData, 16);
 
   if (DNA_CheckResponseCMACtWithData(backData, 16, &backData[16]) ==
       DNA_WRONG_RESPONSE_CMAC)
@@ -1939,9 +1937,9 @@ Ntag424::DNA_StatusCode Ntag424::DNA_Full_ReadData_native(DNA_File file,
   byte IVResp[16];
   DNA_CalculateIVResp(IVResp);
 
-  cbc.setKey(SesAuthEncKey, 16);
-  cbc.setIV(IVResp, 16);
-  cbc.decrypt(backDataDecrypted, backData, lengthWithPadding);
+  cbc_.setKey(SesAuthEncKey, 16);
+  cbc_.setIV(IVResp, 16);
+  cbc_.decrypt(backDataDecrypted, backData, lengthWithPadding);
 
   if (DNA_CheckResponseCMACtWithData(backData, lengthWithPadding,
                                      &backData[lengthWithPadding]) ==
@@ -2115,7 +2113,7 @@ bool Ntag424::DNA_IncrementCmdCtr() {
 void Ntag424::DNA_CalculateCMACt(byte* CMACInput, byte CMACInputSize,
                                  byte* backCMACt) {
   byte CMAC[16];
-  cmac.generateMAC(CMAC, SesAuthMacKey, CMACInput, CMACInputSize);
+  cmac_.generateMAC(CMAC, SesAuthMacKey, CMACInput, CMACInputSize);
 
   byte CMACt[8];
   for (byte i = 0; i < 8; i++) CMACt[i] = CMAC[i * 2 + 1];
@@ -2155,9 +2153,9 @@ void Ntag424::DNA_CalculateDataEncAndCMACt(byte Cmd, byte* dataToEnc,
 
   DNA_CalculateIVCmd(IVCmd);
 
-  cbc.setKey(SesAuthEncKey, 16);
-  cbc.setIV(IVCmd, 16);
-  cbc.encrypt(dataEnc, dataToEnc, dataToEncLen);
+  cbc_.setKey(SesAuthEncKey, 16);
+  cbc_.setIV(IVCmd, 16);
+  cbc_.encrypt(dataEnc, dataToEnc, dataToEncLen);
 
   memcpy(backDataEncAndCMACt, dataEnc, dataToEncLen);
 
@@ -2187,9 +2185,9 @@ void Ntag424::DNA_CalculateIV(byte b0, byte b1, byte* backIV) {
 
   byte zeroIV[16] = {};  // 00000000000000000000000000000000
   byte IVEnc[16];
-  cbc.setKey(SesAuthEncKey, 16);
-  cbc.setIV(zeroIV, 16);
-  cbc.encrypt(IVEnc, IV, 16);
+  cbc_.setKey(SesAuthEncKey, 16);
+  cbc_.setIV(zeroIV, 16);
+  cbc_.encrypt(IVEnc, IV, 16);
 
   memcpy(backIV, IVEnc, 16);
 }
@@ -2207,10 +2205,10 @@ void Ntag424::DNA_GenerateSesAuthKeys(const byte* authKey, byte* RndA,
   byte SV[32];
 
   DNA_CalculateSV1(RndA, RndB, SV);
-  cmac.generateMAC(SesAuthEncKey, authKey, SV, 32);
+  cmac_.generateMAC(SesAuthEncKey, authKey, SV, 32);
 
   DNA_CalculateSV2(RndA, RndB, SV);
-  cmac.generateMAC(SesAuthMacKey, authKey, SV, 32);
+  cmac_.generateMAC(SesAuthMacKey, authKey, SV, 32);
 }
 
 void Ntag424::DNA_CalculateSV(byte b0, byte b1, byte* RndA, byte* RndB,
@@ -10,9 +10,11 @@
 #include <CRC32.h>
 
 #include "../../common.h"
-#include "PN532.h"
 
+// Declared in PN532.h, which needs the device's USART and RTOS APIs. Kept out
+// of this header so the terminal state (and the UI) builds on the host.
 class PN532;
+struct SelectedTag;
 
 enum Ntag424Key : byte;
 
@@ -284,6 +286,12 @@ class Ntag424 {
  protected:
   PN532* pcd_;
 
+  // Ciphers of the session with the selected tag. Held per instance, so tags
+  // on several readers can be authenticated concurrently.
+  CBC<AES128> cbc_;
+  AESTiny128 aes128_;
+  AES_CMAC cmac_{aes128_};
+
   DNA_StatusCode DNA_AuthenticateEV2First_Part1(byte keyNumber, byte* backData,
                                                 byte* backLen);
   DNA_StatusCode DNA_AuthenticateEV2First_Part2(byte* inData, byte* backData,
@@ -1,6 +1,10 @@
 
 #include "PN532.h"
 
+#include <mutex>
+
+#include "common/trace_log.h"
+
 Logger PN532::logger("pn532");
 
 #define PN532_FRAME_MAX_LENGTH 255
@@ -13,7 +17,7 @@ const uint8_t PN532_FRAME_START[] = {PN532_PREAMBLE, PN532_STARTCODE1,
 // PN532, V1.6
 const uint8_t PN532_FIRMWARE_RESPONSE[] = {0x32, 0x01, 0x06, 0x07};
 
-PN532::PN532(USARTSerial* serialInterface, uint8_t resetPin, uint8_t irqPin)
+PN532::PN532(USARTSerial* serialInterface, uint8_t resetPin, int8_t irqPin)
     : is_initialized_(false),
       serial_interface_(serialInterface),
       irq_pin_(irqPin),
@@ -30,13 +34,16 @@ tl::expected<void, PN532Error> PN532::Begin() {
               serial_interface_->interface(), irq_pin_, reset_pin_);
 
   os_semaphore_create(&response_available_, 1, 0);
+  os_mutex_recursive_create(&command_mutex_);
 
   pinMode(reset_pin_, OUTPUT);
   digitalWrite(reset_pin_, HIGH);
 
-  pinMode(irq_pin_, INPUT);
-  attachInterrupt(irq_pin_, &PN532::ResponseAvailableInterruptHandler, this,
-                  FALLING);
+  if (irq_pin_ >= 0) {
+    pinMode(irq_pin_, INPUT);
+    attachInterrupt(irq_pin_, &PN532::ResponseAvailableInterruptHandler, this,
+                    FALLING);
+  }
 
   serial_interface_->begin(115200);
 
@@ -47,12 +54,12 @@ tl::expected<void, PN532Error> PN532::Begin() {
   return ResetController();
 }
 
-tl::expected<std::shared_ptr<SelectedTag>, PN532Error> PN532::WaitForNewTag(
-    system_tick_t timeout_ms) {
+tl::expected<std::vector<std::shared_ptr<SelectedTag>>, PN532Error>
+PN532::WaitForNewTags(uint8_t max_tg, system_tick_t timeout_ms) {
   // MaxTg is the maximum number of targets to be initialized by the PN532.
   // The PN532 is capable of handling 2 targets maximum at once, so this field
   // should not exceed 0x02
-  uint8_t max_tg = 1;
+  max_tg = std::min(max_tg, max_targets);
 
   // BrTy is the baud rate and the modulation type to be used during the
   // initialization. 0x00 is 106 kbps type A (ISO/IEC14443 Type A),
@@ -68,7 +75,9 @@ tl::expected<std::shared_ptr<SelectedTag>, PN532Error> PN532::WaitForNewTag(
 
   auto call_function = CallFunction(&list_passive_target, timeout_ms, 1);
   if (!call_function) {
-    logger.error("WaitForTag InListPassiveTarget failed");
+    if (call_function.error() != PN532Error::kTimeout) {
+      logger.error("WaitForTag InListPassiveTarget failed");
+    }
     return tl::unexpected(call_function.error());
   }
 
@@ -77,26 +86,75 @@ tl::expected<std::shared_ptr<SelectedTag>, PN532Error> PN532::WaitForNewTag(
     return tl::unexpected(PN532Error::kEmptyResponse);
   }
 
-  uint8_t number_targets = list_passive_target.params[0];
+  uint8_t number_targets = std::min(list_passive_target.params[0], max_tg);
   if (number_targets == 0) {
     return tl::unexpected(PN532Error::kNoTarget);
   }
 
-  // Only interested in tg ID and NFC ID
-  uint8_t tg = list_passive_target.params[1];
+  std::vector<std::shared_ptr<SelectedTag>> result;
+  auto params = list_passive_target.params;
+  size_t offset = 1;
+  for (uint8_t i = 0; i < number_targets; i++) {
+    // Tg, SENS_RES (2 bytes), SEL_RES, NFCIDLength, NFCID, [ATS]. Only
+    // interested in tg ID and NFC ID
+    if (offset + 5 > list_passive_target.params_length) {
+      logger.error("WaitForTag InListPassiveTarget response truncated");
+      return tl::unexpected(PN532Error::kEmptyResponse);
+    }
+
+    uint8_t tg = params[offset];
+    uint8_t sel_res = params[offset + 3];
+    size_t nfc_id_length = params[offset + 4];
+    offset += 5;
 
-  size_t nfc_id_length = list_passive_target.params[5];
+    if (nfc_id_length > 7 ||
+        offset + nfc_id_length > list_passive_target.params_length) {
+      logger.error("WaitForTag InListPassiveTarget invalid NFCID");
+      return tl::unexpected(PN532Error::kEmptyResponse);
+    }
+
+    auto tag = std::shared_ptr<SelectedTag>{
+        new SelectedTag{.tg = tg, .nfc_id_length = nfc_id_length}};
+    std::memcpy(tag->nfc_id.data(), params + offset, nfc_id_length);
+    offset += nfc_id_length;
+    result.push_back(std::move(tag));
 
-  auto result = std::shared_ptr<SelectedTag>{
-      new SelectedTag{.tg = tg, .nfc_id_length = nfc_id_length}};
+    // ISO/IEC14443-4 compliant targets are followed by their ATS, whose
+    // first byte is its length.
+    if ((sel_res & 0x20) && offset < list_passive_target.params_length) {
+      offset += params[offset];
+    }
+  }
 
-  std::memcpy(result->nfc_id.data(), std::begin(list_passive_target.params) + 6,
-              nfc_id_length);
+  // With two targets it is not specified which one stays active.
+  active_tg_ = number_targets == 1 ? result[0]->tg : 0;
 
   return {result};
 }
 
-tl::expected<bool, PN532Error> PN532::CheckTagStillAvailable() {
+tl::expected<bool, PN532Error> PN532::CheckTagStillAvailable(
+    const SelectedTag& tag) {
+  if (tag.tg != active_tg_) {
+    // Diagnose only tests the active target. Selecting the target instead
+    // tests its presence as well.
+    DataFrame select{.command = PN532_COMMAND_INSELECT,
+                     .params = {tag.tg},
+                     .params_length = 1};
+
+    auto call_function = CallFunction(&select, 100, 1);
+    if (!call_function) {
+      logger.error("CheckTagStillAvailable InSelect failed");
+      return tl::unexpected(call_function.error());
+    }
+
+    if (select.params_length != 1) {
+      logger.error("CheckTagStillAvailable InSelect response wrong length");
+      return tl::unexpected(PN532Error::kEmptyResponse);
+    }
+
+    return {select.params[0] == 0x00};
+  }
+
   //  NumTst = 0x06 : Attention Request Test or ISO/IEC14443-4 card presence
   //  detection
 
@@ -145,10 +203,15 @@ tl::expected<void, PN532Error> PN532::ReleaseTag(
     return tl::unexpected(call_function.error());
   }
 
+  if (tag->tg == active_tg_) active_tg_ = 0;
+
   return {};
 }
 
 tl::expected<void, PN532Error> PN532::ConfigureGpio72() {
+  // Read-modify-write of the P7 configuration
+  std::lock_guard<PN532> lock(*this);
+
   DataFrame read_register{.command = PN532_COMMAND_READREGISTER,
                           .params =
                               {
@@ -186,7 +249,7 @@ tl::expected<void, PN532Error> PN532::ConfigureGpio72() {
     return tl::unexpected(write_register_result.error());
   }
 
-  return SetGpio72(false);
+  return {};
 }
 
 tl::expected<void, PN532Error> PN532::SetGpio72(bool high) {
@@ -232,6 +295,17 @@ tl::expected<void, PN532Error> PN532::ReceiveResponse(DataFrame* response_data,
                                                       int retries) {
   uint32_t tickstart = millis();
   while (true) {
+    auto elapsed = millis() - tickstart;
+    if (timeout_ms != CONCURRENT_WAIT_FOREVER && elapsed > timeout_ms) {
+      return tl::unexpected(PN532Error::kTimeout);
+    }
+
+    if (!SleepUntilResponseAvailable(timeout_ms == CONCURRENT_WAIT_FOREVER
+                                         ? CONCURRENT_WAIT_FOREVER
+                                         : timeout_ms - elapsed)) {
+      return tl::unexpected(PN532Error::kTimeout);
+    }
+
     auto consume_start_sequence = ConsumeFrameStartSequence();
     if (consume_start_sequence.has_value()) {
       break;
@@ -240,11 +314,6 @@ tl::expected<void, PN532Error> PN532::ReceiveResponse(DataFrame* response_data,
     if (consume_start_sequence.error() != PN532Error::kTimeout) {
       return consume_start_sequence;
     }
-
-    delay(5);
-    if (millis() - tickstart > timeout_ms) {
-      return tl::unexpected(PN532Error::kTimeout);
-    }
   }
 
   auto read_frame = ReadFrame(response_data);
@@ -265,6 +334,15 @@ tl::expected<void, PN532Error> PN532::ReceiveResponse(DataFrame* response_data,
 
 tl::expected<void, PN532Error> PN532::CallFunction(
     DataFrame* command_in_response_out, system_tick_t timeout_ms, int retries) {
+  std::lock_guard<PN532> lock(*this);
+
+  // Exchanges with a target implicitly select it, deselecting the previously
+  // active one.
+  if (command_in_response_out->command == PN532_COMMAND_INDATAEXCHANGE ||
+      command_in_response_out->command == PN532_COMMAND_INSELECT) {
+    active_tg_ = command_in_response_out->params[0];
+  }
+
   auto send_command = SendCommand(command_in_response_out, retries);
   if (!send_command) {
     logger.error("CallFunction SendCommand failed");
@@ -274,12 +352,17 @@ tl::expected<void, PN532Error> PN532::CallFunction(
   auto receive_response =
       ReceiveResponse(command_in_response_out, timeout_ms, retries);
   if (!receive_response) {
-    logger.error("CallFunction ReceiveResponse failed (error: %d)",
-                 (int)receive_response.error());
     if (receive_response.error() == PN532Error::kTimeout) {
+      // Callers waiting with a timeout expect it to expire, leave it to them
+      // to report.
+      logger.trace("CallFunction ReceiveResponse timed out");
+
       // see "6.2.2.1 Data link level", section "d) Abort"
       // When receiving the response timed out, send ACK to abort
       serial_interface_->write(PN532_ACK, sizeof(PN532_ACK));
+    } else {
+      logger.error("CallFunction ReceiveResponse failed (error: %d)",
+                   (int)receive_response.error());
     }
 
     return receive_response;
@@ -290,6 +373,8 @@ tl::expected<void, PN532Error> PN532::CallFunction(
 
 tl::expected<void, PN532Error> PN532::ResetController() {
   logger.info("PN532::ResetController");
+  std::lock_guard<PN532> lock(*this);
+  active_tg_ = 0;
 
   digitalWrite(reset_pin_, LOW);
   // 100us should be enough to reset, RSTOUT would indicate that PN532 is
@@ -392,12 +477,9 @@ tl::expected<void, PN532Error> PN532::WriteFrame(DataFrame* command_data) {
 
   serial_interface_->flush();
 
-  if (logger.isTraceEnabled()) {
-    logger.trace(
-        "WriteFrame(%#04x)[%s]", command_data->command,
-        BytesToHexString(command_data->params, command_data->params_length)
-            .c_str());
-  }
+  TraceLog::instance().Write(logger, "WriteFrame(%#04lx)", command_data->command,
+                             command_data->params,
+                             command_data->params_length);
 
   return {};
 }
@@ -475,12 +557,9 @@ tl::expected<void, PN532Error> PN532::ReadFrame(DataFrame* response_data) {
     return tl::unexpected(PN532Error::kUnspecified);
   }
 
-  if (logger.isTraceEnabled()) {
-    logger.trace(
-        "ReadFrame(%#04x)[%s]", response_command,
-        BytesToHexString(response_data->params, response_data->params_length)
-            .c_str());
-  }
+  TraceLog::instance().Write(logger, "ReadFrame(%#04lx)", response_command,
+                             response_data->params,
+                             response_data->params_length);
 
   uint8_t checksum = frame_identifier + response_command;
   // Check frame checksum value matches bytes.
@@ -561,6 +640,37 @@ tl::expected<void, PN532Error> PN532::ConsumeFrameStartSequence() {
   return {};
 }
 
+bool PN532::SleepUntilResponseAvailable(system_tick_t timeout_ms) {
+  // With IRQ, the semaphore wakes us as soon as the response is ready. The
+  // wait is still sliced, as an IRQ that fired before the wait started (e.g.
+  // for the ACK frame) must not delay the response until the timeout.
+  constexpr system_tick_t irq_slice_ms = 100;
+  constexpr system_tick_t poll_slice_ms = 5;
+
+  auto start = millis();
+  while (serial_interface_->available() == 0) {
+    auto elapsed = millis() - start;
+    if (timeout_ms != CONCURRENT_WAIT_FOREVER && elapsed >= timeout_ms) {
+      return false;
+    }
+
+    system_tick_t slice = irq_pin_ >= 0 ? irq_slice_ms : poll_slice_ms;
+    if (timeout_ms != CONCURRENT_WAIT_FOREVER) {
+      slice = std::min(slice, timeout_ms - elapsed);
+    }
+
+    auto sleep_start = micros();
+    if (irq_pin_ >= 0) {
+      os_semaphore_take(response_available_, slice, false);
+    } else {
+      delay(slice);
+    }
+    sleep_time_us_ += micros() - sleep_start;
+  }
+
+  return true;
+}
+
 void PN532::ResponseAvailableInterruptHandler() {
   os_semaphore_give(response_available_, false);
 }
\ No newline at end of file
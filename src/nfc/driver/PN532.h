@@ -32,6 +32,11 @@ enum class PN532Error : int {
 class Ntag424;
 
 // Communicates with a PN532 via UART.
+//
+// Commands are serialized, so the PN532 may be used from multiple threads
+// (e.g. for reading tags and switching a relay via P72). A command blocks
+// other threads until its response is received, so long running commands
+// like WaitForNewTag() should be called with a timeout.
 class PN532 {
   friend Ntag424;
 
@@ -41,8 +46,9 @@ class PN532 {
   // Args:
   //   serial_interface: The interface on which the PN532 is connected.
   //   reset_pin: P2 pin connected to P70_IRQ's RSTPD_N pin.
-  //   irq_pin: P2 pin connected to PN532's P70_IRQ pin.
-  PN532(USARTSerial* serial_interface, uint8_t reset_pin, uint8_t irq_pin);
+  //   irq_pin: P2 pin connected to PN532's P70_IRQ pin, or -1 if not
+  //     connected. Without IRQ, pending responses are polled.
+  PN532(USARTSerial* serial_interface, uint8_t reset_pin, int8_t irq_pin);
 
   // Initializes the PN532 controller.
   //
@@ -50,12 +56,23 @@ class PN532 {
   // resets the PN532 and configures it for Initiator / PCD mode.
   tl::expected<void, PN532Error> Begin();
 
-  // Waits for a single ISO/IEC14443 Type A tag to be detected.
-  tl::expected<std::shared_ptr<SelectedTag>, PN532Error> WaitForNewTag(
-      system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER);
+  // Targets listed at once, see config::nfc::max_targets.
+  static constexpr uint8_t max_targets = config::nfc::max_targets;
+  static_assert(max_targets > 0 && max_targets <= 2,
+                "The PN532 handles at most two targets at once");
+
+  // Waits for ISO/IEC14443 Type A tags to be detected, and lists up to
+  // max_tg of the tags in the field. Each tag gets its own logical ID (Tg).
+  // An exchange with one Tg deselects the other, see TagSessionArbiter.
+  //
+  // Returns PN532Error::kTimeout if no tag was detected within timeout_ms.
+  tl::expected<std::vector<std::shared_ptr<SelectedTag>>, PN532Error>
+  WaitForNewTags(uint8_t max_tg,
+                 system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER);
 
-  // Check whether previously selected tag is still available.
-  tl::expected<bool, PN532Error> CheckTagStillAvailable();
+  // Check whether a previously listed tag is still available.
+  tl::expected<bool, PN532Error> CheckTagStillAvailable(
+      const SelectedTag& tag);
 
   tl::expected<void, PN532Error> ReleaseTag(std::shared_ptr<SelectedTag> tag);
 
@@ -63,12 +80,22 @@ class PN532 {
   // it as PCD
   tl::expected<void, PN532Error> ResetController();
 
-  // Configures P72 as an output
+  // Configures P72 as a push/pull output. The pin drives the level last
+  // written with SetGpio72, so set that first to avoid a glitch.
   tl::expected<void, PN532Error> ConfigureGpio72();
 
   // Sets the status of P72 GPIO
   tl::expected<void, PN532Error> SetGpio72(bool high);
 
+  // Locks the PN532 for a sequence of commands, e.g. for the exchanges of an
+  // authenticated tag session. Satisfies BasicLockable.
+  void lock() { os_mutex_recursive_lock(command_mutex_); }
+  void unlock() { os_mutex_recursive_unlock(command_mutex_); }
+
+  // Total time in microseconds the caller was put to sleep while waiting for
+  // the PN532 to respond.
+  uint64_t GetSleepTime() const { return sleep_time_us_; }
+
  private:
   // Sends the command_data payload to the PN532.
   //
@@ -113,7 +140,12 @@ class PN532 {
   int8_t irq_pin_;
   int8_t reset_pin_;
   os_semaphore_t response_available_;
+  // Held while a command is in progress.
+  os_mutex_recursive_t command_mutex_ = 0;
   system_tick_t command_timeout_ms_;
+  uint64_t sleep_time_us_ = 0;
+  // Tg of the target the PN532 currently communicates with, 0 if unknown.
+  uint8_t active_tg_ = 0;
 
   // Verified the communication and checks the expected response to
   // GetFirmwareVersion
@@ -127,6 +159,9 @@ class PN532 {
   tl::expected<void, PN532Error> ReadAckFrame();
   // Reads and discards input until frame start sequence 0x00 0xFF is received.
   tl::expected<void, PN532Error> ConsumeFrameStartSequence();
+  // Sleeps until the first byte of a response is available, or until
+  // timeout_ms passed. Returns false on timeout.
+  bool SleepUntilResponseAvailable(system_tick_t timeout_ms);
   // ISR handler for irq_pin_, signals response_available_
   void ResponseAvailableInterruptHandler();
 
@@ -1,7 +1,10 @@
 #include "nfc_tags.h"
 
+#include <algorithm>
+
 #include "../config.h"
 #include "../state/configuration.h"
+#include "common/boot_timeline.h"
 #include "common/byte_array.h"
 
 using namespace config::nfc;
@@ -9,19 +12,49 @@ using namespace config::tag;
 
 Logger NfcTags::logger("nfc");
 
-NfcTags *NfcTags::instance_;
-
-NfcTags &NfcTags::instance() {
-  if (!instance_) {
-    instance_ = new NfcTags();
+// Back-off after a failed PCD command, instead of retrying in a tight loop.
+constexpr system_tick_t pcd_error_backoff_ms = 100;
+
+static_assert(std::size(readers) <= 3, "P2 has three USARTs");
+
+// Boot stage of each reader in config::nfc::readers.
+constexpr BootStage reader_stages[] = {
+    BootStage::kNfcReader0, BootStage::kNfcReader1, BootStage::kNfcReader2};
+static_assert(std::size(readers) <= std::size(reader_stages));
+
+// Returns the USART with the given number, or nullptr if the device has none.
+static USARTSerial *GetSerialInterface(uint8_t serial) {
+  switch (serial) {
+    case 1:
+      return &Serial1;
+#if Wiring_Serial2
+    case 2:
+      return &Serial2;
+#endif
+#if Wiring_Serial3
+    case 3:
+      return &Serial3;
+#endif
+    default:
+      return nullptr;
   }
-  return *instance_;
 }
 
-NfcTags::NfcTags() {
-  pcd_interface_ = std::make_unique<PN532>(&Serial1, config::nfc::pin_reset,
-                                           config::nfc::pin_reset);
-  ntag_interface_ = std::make_unique<Ntag424>(pcd_interface_.get());
+NfcTags::NfcTags(oww::state::ReaderIndex reader,
+                 const config::nfc::Reader &config)
+    : reader_(reader) {
+  auto serial_interface = GetSerialInterface(config.serial);
+  if (!serial_interface) {
+    logger.error("Reader %d: no USART Serial%d", reader_, config.serial);
+    return;
+  }
+
+  pcd_interface_ = std::make_unique<PN532>(serial_interface, config.pin_reset,
+                                           config.pin_irq);
+  for (size_t i = 0; i < ntag_interfaces_.size(); i++) {
+    ntag_interfaces_[i] = std::make_unique<Ntag424>(pcd_interface_.get());
+    targets_[i].target = i;
+  }
 }
 
 NfcTags::~NfcTags() {}
@@ -32,21 +65,16 @@ Status NfcTags::Begin(std::shared_ptr<oww::state::State> state) {
     return Status::kError;
   }
 
-  state_ = state;
-
-  auto pcd_begin = pcd_interface_->Begin();
-  if (!pcd_begin) {
-    logger.error("Initialization of PN532 failed");
+  if (!pcd_interface_) {
+    // Without a worker, nothing else would mark the reader as done.
+    BootTimeline::instance().Mark(reader_stages[reader_]);
     return Status::kError;
   }
 
-  auto pcd_config_gpio = pcd_interface_->ConfigureGpio72();
-  if (!pcd_config_gpio) {
-    logger.error("Initialization of PN532 GPIO");
-    return Status::kError;
-  }
+  state_ = state;
 
   os_mutex_create(&mutex_);
+  os_semaphore_create(&wake_, 1, 0);
 
   thread_ = new Thread(
       "NfcTags", [this]() { NfcThread(); }, thread_priority, thread_stack_size);
@@ -54,92 +82,196 @@ Status NfcTags::Begin(std::shared_ptr<oww::state::State> state) {
   return Status::kOk;
 }
 
-enum class NfcState {
-  kWaitForTag = 0,
-  kTagIdle = 1,
-  kTagUnknown = 2,
-  kTagError = 3,
+static constexpr const char *nfc_state_names[] = {
+    "WaitForTag", "TagIdle", "TagUnknown", "TagError", "TagListed"};
 
-};
-
-// NfcTags internal state machine.
-// This is intentionally separate from state_ and the Pn532/Ntag424
-// state
-struct NfcStateData {
-  NfcState state;
-  std::shared_ptr<SelectedTag> selected_tag;
-  int error_count;
-};
+// Enters kTagIdle, with the queued action of the new terminal state due
+// right away.
+static void EnterTagIdle(NfcStateData &data) {
+  data.state = NfcState::kTagIdle;
+  data.next_presence_check = millis() + presence_check_interval_ms;
+  data.next_action = 0;
+}
 
 os_thread_return_t NfcTags::NfcThread() {
-  NfcStateData state_data{.state = NfcState::kWaitForTag, .error_count = 0};
+  // Resetting the PN532 takes a few 10 ms, which overlaps with the other
+  // readers and with loading the state.
+  auto pcd_begin = pcd_interface_->Begin();
+  pcd_status_ = pcd_begin ? Status::kOk : Status::kError;
+  BootTimeline::instance().Mark(reader_stages[reader_]);
+  if (!pcd_begin) {
+    logger.error("Initialization of PN532 of reader %d failed", reader_);
+    return;
+  }
 
-  auto is_relais_on = false;
+  BootTimeline::instance().WaitFor(BootStage::kState);
+  state_stats_start_ = millis();
 
   while (true) {
-    NfcLoop(state_data);
+    // A completed cloud response makes the queued action of the target that
+    // awaits it due.
+    auto resumed = resumed_targets_.exchange(0);
+    for (auto &data : targets_) {
+      if (resumed & (1 << data.target)) data.next_action = 0;
+    }
 
-    // FIXME that does not belong here
-    auto should_relais_be_on = false;
-    auto current_state = state_->GetTerminalState();
-    using namespace oww::state::terminal;
+    // Accounts the time of a call to the stats of the state it started in.
+    // Time the PN532 driver slept waiting for a response (i.e. for a tag in
+    // kWaitForTag) does not count as CPU time.
+    auto measure = [this](NfcState state, auto call) {
+      auto &stats = state_stats_[static_cast<int>(state)];
+      auto pass_start = micros();
+      auto pcd_sleep_start = pcd_interface_->GetSleepTime();
+
+      system_tick_t result = call();
+
+      auto pcd_sleep = pcd_interface_->GetSleepTime() - pcd_sleep_start;
+      stats.busy_us += (micros() - pass_start) - pcd_sleep;
+      stats.sleep_us += pcd_sleep;
+      stats.passes++;
+      return result;
+    };
+
+    auto active_target = std::find_if(
+        targets_.begin(), targets_.end(), [](const NfcStateData &data) {
+          return data.state != NfcState::kWaitForTag;
+        });
+
+    system_tick_t time_till_next_pass = CONCURRENT_WAIT_FOREVER;
+    if (active_target == targets_.end()) {
+      time_till_next_pass =
+          measure(NfcState::kWaitForTag, [this]() { return WaitForTags(); });
+    } else {
+      // One step of each target per pass. While a target's tag session is in
+      // progress, the other targets must not select their tag.
+      for (auto &data : targets_) {
+        if (data.state == NfcState::kWaitForTag) continue;
+        if (!session_arbiter_.MayExchange(data.target)) continue;
+        time_till_next_pass = std::min(
+            time_till_next_pass,
+            measure(data.state, [this, &data]() { return NfcLoop(data); }));
+      }
+    }
 
-    if (std::get_if<StartSession>(current_state.get())) {
-      logger.trace("Should Be ON");
+    if (pcd_reset_) {
+      // The reset released all targets.
+      pcd_reset_ = false;
+      for (auto &data : targets_) {
+        if (data.state != NfcState::kWaitForTag) ReleaseTarget(data);
+      }
+      time_till_next_pass = 0;
+    }
 
-      should_relais_be_on = true;
-    } else {
-      should_relais_be_on = false;
+    if (time_till_next_pass > 0) {
+      auto sleep_state = active_target == targets_.end()
+                             ? NfcState::kWaitForTag
+                             : active_target->state;
+      auto sleep_start = micros();
+      os_semaphore_take(wake_, time_till_next_pass, false);
+      state_stats_[static_cast<int>(sleep_state)].sleep_us +=
+          micros() - sleep_start;
     }
 
-    if (is_relais_on != should_relais_be_on) {
-      is_relais_on = should_relais_be_on;
-      logger.trace("Toggle Relais %d", is_relais_on ? 1 : 0);
-      pcd_interface_->SetGpio72(is_relais_on);
+    if (millis() - state_stats_start_ >= stats_interval_ms) {
+      LogStateStats();
     }
   }
 }
 
-void NfcTags::NfcLoop(NfcStateData &data) {
-  logger.trace("NfcLoop %d", (int)data.state);
+void NfcTags::Wake() { os_semaphore_give(wake_, false); }
+
+void NfcTags::LogStateStats() {
+  auto interval_us =
+      static_cast<uint64_t>(millis() - state_stats_start_) * 1000;
+
+  for (size_t i = 0; i < state_stats_.size(); i++) {
+    auto &stats = state_stats_[i];
+    if (stats.passes == 0) continue;
+
+    // CPU usage in 1/100 percent of the interval
+    auto usage = static_cast<uint32_t>(stats.busy_us * 10000 / interval_us);
+    logger.info("Reader %d %s: cpu %lu.%02lu%% (%lu ms busy, %lu ms asleep, "
+                "%lu passes)",
+                reader_, nfc_state_names[i], usage / 100, usage % 100,
+                static_cast<uint32_t>(stats.busy_us / 1000),
+                static_cast<uint32_t>(stats.sleep_us / 1000), stats.passes);
+    stats = {};
+  }
+
+  state_stats_start_ = millis();
+}
+
+system_tick_t NfcTags::NfcLoop(NfcStateData &data) {
+  logger.trace("NfcLoop %d.%d %d", reader_, data.target, (int)data.state);
   switch (data.state) {
     case NfcState::kWaitForTag:
-      WaitForTag(data);
-      return;
+      // New tags are listed by WaitForTags() for all targets at once.
+      return CONCURRENT_WAIT_FOREVER;
 
     case NfcState::kTagIdle:
-      if (!CheckTagStillAvailable(data)) return;
-
-      TagPerformQueuedAction(data);
-      return;
+      return TagIdle(data);
 
     case NfcState::kTagUnknown:
-      CheckTagStillAvailable(data);
-      return;
+      if (!CheckTagStillAvailable(data)) return 0;
+      return presence_check_interval_ms;
 
     case NfcState::kTagError:
-      TagError(data);
-      return;
+      return TagError(data);
+
+    case NfcState::kTagListed:
+      DetectTag(data);
+      return 0;
   }
+
+  return 0;
 }
 
-void NfcTags::WaitForTag(NfcStateData &data) {
-  auto wait_for_tag = pcd_interface_->WaitForNewTag();
-  if (!wait_for_tag) return;
+system_tick_t NfcTags::WaitForTags() {
+  // Sleeps in the PN532 driver until a tag is detected. Tags entering the
+  // field while another one is in use are listed after its removal, as
+  // listing again would release the targets in use.
+  auto wait_for_tags =
+      pcd_interface_->WaitForNewTags(max_targets, tag_wait_timeout_ms);
+  if (!wait_for_tags && wait_for_tags.error() != PN532Error::kTimeout) {
+    return pcd_error_backoff_ms;
+  }
 
-  auto selected_tag = wait_for_tag.value();
-  data.selected_tag = selected_tag;
+  std::vector<std::shared_ptr<SelectedTag>> selected_tags;
+  if (wait_for_tags) selected_tags = std::move(wait_for_tags.value());
+
+  for (size_t i = 0; i < targets_.size(); i++) {
+    auto &data = targets_[i];
+    if (i < selected_tags.size()) {
+      // The first tag is identified right away, the others once its session
+      // ended.
+      data.selected_tag = selected_tags[i];
+      data.state = NfcState::kTagListed;
+      if (i == 0) DetectTag(data);
+    } else if (data.error_count > 0) {
+      // A tag being retried after an error has been removed.
+      ReleaseTarget(data);
+    }
+  }
+
+  // The wait timing out regularly releases the PN532 for other users.
+  return 0;
+}
+
+void NfcTags::DetectTag(NfcStateData &data) {
+  auto &selected_tag = data.selected_tag;
+  auto &ntag_interface = ntag_interfaces_[data.target];
+  session_arbiter_.Begin(data.target);
   if (logger.isInfoEnabled()) {
-    logger.info("Found tag with UID %s",
+    logger.info("Reader %d found tag %d with UID %s", reader_, data.target,
                 ToHexString(selected_tag->nfc_id).c_str());
   }
 
-  ntag_interface_->SetSelectedTag(selected_tag);
+  ntag_interface->SetSelectedTag(selected_tag);
 
-  state_->OnTagFound();
+  state_->OnTagFound(reader_, data.target);
 
   auto select_application_result =
-      ntag_interface_->DNA_Plain_ISOSelectFile_Application();
+      ntag_interface->DNA_Plain_ISOSelectFile_Application();
   if (select_application_result != Ntag424::DNA_STATUS_OK) {
     // card communication might be unstable, or the application file cannot be
     // selected.
@@ -149,7 +281,7 @@ void NfcTags::WaitForTag(NfcStateData &data) {
     return;
   }
 
-  auto terminal_authenticate = ntag_interface_->Authenticate(
+  auto terminal_authenticate = ntag_interface->Authenticate(
       /* key_number = */ key_terminal,
       state_->GetConfiguration()->GetTerminalKey());
 
@@ -159,16 +291,16 @@ void NfcTags::WaitForTag(NfcStateData &data) {
       logger.info("Authenticated tag with terminal key");
     }
 
-    auto card_uid = ntag_interface_->GetCardUID();
+    auto card_uid = ntag_interface->GetCardUID();
     if (!card_uid) {
       logger.error("Unable to read card UID");
       data.state = NfcState::kTagError;
       return;
     }
 
-    data.state = NfcState::kTagIdle;
-    state_->OnTagAuthenicated(card_uid.value());
-
+    state_->OnTagAuthenicated(reader_, data.target, card_uid.value());
+    EnterTagIdle(data);
+    UpdateTagSession(data);
     return;
   }
 
@@ -177,27 +309,49 @@ void NfcTags::WaitForTag(NfcStateData &data) {
                 terminal_authenticate.error());
   }
 
-  auto is_new_tag = ntag_interface_->IsNewTagWithFactoryDefaults();
+  auto is_new_tag = ntag_interface->IsNewTagWithFactoryDefaults();
   if (!is_new_tag.has_value()) {
     logger.error("IsNewTagWithFactoryDefaults failed %d", is_new_tag.error());
     data.state = NfcState::kTagError;
+    return;
   }
 
   if (is_new_tag.value() && selected_tag->nfc_id_length == 7) {
-    state_->OnBlankNtag(selected_tag->nfc_id);
-    data.state = NfcState::kTagIdle;
+    state_->OnBlankNtag(reader_, data.target, selected_tag->nfc_id);
+    EnterTagIdle(data);
+    UpdateTagSession(data);
     return;
   }
 
-  state_->OnUnknownTag();
+  state_->OnUnknownTag(reader_, data.target);
   data.state = NfcState::kTagUnknown;
+  session_arbiter_.End(data.target);
 }
 
-boolean NfcTags::CheckTagStillAvailable(NfcStateData &data) {
-  // Poll with 10Hz
-  delay(100);
+void NfcTags::UpdateTagSession(const NfcStateData &data) {
+  using namespace oww::state;
+  auto tag_state = state_->GetTerminalState(reader_, data.target);
+
+  // A flow holds the session while awaiting the cloud as well, as e.g. the
+  // second part of an EV2 authentication continues the first one.
+  auto in_progress = std::visit(
+      overloaded{
+          [](const terminal::StartSession &state) {
+            return !terminal::IsCompleted(state);
+          },
+          [](const terminal::Personalize &state) {
+            return !terminal::IsCompleted(state);
+          },
+          [](const auto &) { return false; },
+      },
+      *tag_state);
+
+  if (!in_progress) session_arbiter_.End(data.target);
+}
 
-  auto check_still_available = pcd_interface_->CheckTagStillAvailable();
+boolean NfcTags::CheckTagStillAvailable(NfcStateData &data) {
+  auto check_still_available =
+      pcd_interface_->CheckTagStillAvailable(*data.selected_tag);
   if (!check_still_available) {
     logger.error("TagIdle::CheckTagStillAvailable returned PCD error: %d",
                  (int)check_still_available.error());
@@ -219,42 +373,117 @@ boolean NfcTags::CheckTagStillAvailable(NfcStateData &data) {
                 (int)release_tag.error());
   }
 
+  ReleaseTarget(data);
+
+  return false;
+}
+
+void NfcTags::ReleaseTarget(NfcStateData &data) {
+  session_arbiter_.End(data.target);
   data.state = NfcState::kWaitForTag;
   data.selected_tag = nullptr;
-  state_->OnTagRemoved();
+  data.error_count = 0;
+  state_->OnTagRemoved(reader_, data.target);
+}
 
-  return false;
+system_tick_t NfcTags::TagIdle(NfcStateData &data) {
+  auto now = millis();
+  if (now >= data.next_presence_check) {
+    if (!CheckTagStillAvailable(data)) return 0;
+    data.next_presence_check = now + presence_check_interval_ms;
+  }
+
+  // The queued action only makes progress on a state transition, the
+  // completion of the cloud response it awaits (see NfcThread) or when its own
+  // timer expired.
+  auto state_version = state_->GetTerminalStateVersion(reader_, data.target);
+  if (state_version != data.terminal_state_version ||
+      now >= data.next_action) {
+    data.terminal_state_version = state_version;
+
+    auto time_till_next_action = TagPerformQueuedAction(data);
+    UpdateTagSession(data);
+    data.next_action = time_till_next_action == CONCURRENT_WAIT_FOREVER
+                           ? CONCURRENT_WAIT_FOREVER
+                           : millis() + time_till_next_action;
+
+    // Loop a new state right away
+    if (state_->GetTerminalStateVersion(reader_, data.target) !=
+        state_version) {
+      return 0;
+    }
+  }
+
+  now = millis();
+  auto next_pass = std::min(data.next_presence_check, data.next_action);
+  return next_pass > now ? next_pass - now : 0;
 }
 
-void NfcTags::TagPerformQueuedAction(NfcStateData &data) {
+system_tick_t NfcTags::TagPerformQueuedAction(NfcStateData &data) {
   using namespace oww::state;
-  auto tag_state = state_->GetTerminalState();
-  if (auto state = std::get_if<terminal::StartSession>(tag_state.get())) {
-    terminal::Loop(*state, *state_, *ntag_interface_.get());
-  } else if (auto state = std::get_if<terminal::Personalize>(tag_state.get())) {
-    terminal::Loop(*state, *state_, *ntag_interface_.get());
-  }
+  auto tag_state = state_->GetTerminalState(reader_, data.target);
+  auto &ntag_interface = *ntag_interfaces_[data.target];
+  CompletionCallback resume = [this, target = data.target]() {
+    resumed_targets_ |= 1 << target;
+    Wake();
+  };
+
+  return Dispatch(
+      *tag_state,
+      overloaded{
+          [&](const terminal::StartSession &state) {
+            return terminal::Loop(state, *state_, ntag_interface, resume);
+          },
+          [&](const terminal::Personalize &state) {
+            return terminal::Loop(state, *state_, ntag_interface, resume);
+          },
+          [](const auto &) -> system_tick_t {
+            return CONCURRENT_WAIT_FOREVER;
+          },
+      });
 }
 
-void NfcTags::TagError(NfcStateData &data) {
-  if (data.error_count > 3) {
-    // wait for card to disappear
-    return;
+system_tick_t NfcTags::TagError(NfcStateData &data) {
+  // Re-listing the tag would release the other targets, so only a single
+  // target is retried.
+  auto other_target_active = std::any_of(
+      targets_.begin(), targets_.end(), [&data](const NfcStateData &other) {
+        return &other != &data && other.state != NfcState::kWaitForTag;
+      });
+
+  if (data.error_count > 3 || other_target_active) {
+    // Give up on the tag and wait for it to disappear, letting the other
+    // targets proceed meanwhile.
+    session_arbiter_.End(data.target);
+    auto check_still_available =
+        pcd_interface_->CheckTagStillAvailable(*data.selected_tag);
+    if (check_still_available && check_still_available.value()) {
+      return presence_check_interval_ms;
+    }
+
+    pcd_interface_->ReleaseTag(data.selected_tag);
+    ReleaseTarget(data);
+    return 0;
   }
 
   auto selected_tag = data.selected_tag;
 
   // Retry re-selecting the tag a couple times.
+  session_arbiter_.End(data.target);
   data.error_count++;
   data.state = NfcState::kWaitForTag;
   data.selected_tag = nullptr;
 
   auto release_tag = pcd_interface_->ReleaseTag(selected_tag);
-  if (release_tag) return;
+  if (release_tag) return 0;
 
   logger.warn("Release failed (%d), resetting PCD ", (int)release_tag.error());
+  pcd_reset_ = true;
   auto reset_controller = pcd_interface_->ResetController();
   if (!reset_controller) {
     logger.error("Resetting PCD failed %d", (int)reset_controller.error());
+    return pcd_error_backoff_ms;
   }
+
+  return 0;
 }
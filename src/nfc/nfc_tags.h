@@ -1,48 +1,137 @@
 #pragma once
 
+#include <atomic>
+
 #include "../common.h"
 #include "../state/state.h"
 #include "driver/Ntag424.h"
 #include "driver/PN532.h"
+#include "tag_session_arbiter.h"
 
-struct NfcStateData;
+enum class NfcState {
+  kWaitForTag = 0,
+  kTagIdle = 1,
+  kTagUnknown = 2,
+  kTagError = 3,
+  // Listed together with another tag, waits for the other target's tag
+  // session to end before being identified.
+  kTagListed = 4,
+};
 
-// Rename to NfcWorker ?
-class NfcTags {
- public:
-  static NfcTags &instance();
+// NfcTags internal state machine of a single target.
+// This is intentionally separate from state_ and the Pn532/Ntag424
+// state
+struct NfcStateData {
+  oww::state::TargetIndex target;
+  NfcState state = NfcState::kWaitForTag;
+  std::shared_ptr<SelectedTag> selected_tag;
+  int error_count = 0;
 
-  Status Begin(std::shared_ptr<oww::state::State> state);
+  // Timers of kTagIdle
+  system_tick_t next_presence_check = 0;
+  system_tick_t next_action = 0;
+  // Terminal state version the queued action was last performed on.
+  uint32_t terminal_state_version = 0;
+};
 
- private:
-  // Display is a singleton - use Display.instance()
-  static NfcTags *instance_;
-  NfcTags();
+// Worker serving a single PN532 reader in its own thread.
+//
+// Each reader has its own transport, tag session and terminal state in
+// State, so several readers work on their tags concurrently. A reader lists
+// up to config::nfc::max_targets tags presented together (e.g. a member's
+// and a supervisor's tag). Each target has its own tag session. Sessions are
+// served one at a time, see TagSessionArbiter; the targets without a session
+// in progress are polled for their presence pass by pass.
+class NfcTags {
+ public:
+  // Args:
+  //   reader: Index of the reader in config::nfc::readers.
+  //   config: The reader's wiring.
+  NfcTags(oww::state::ReaderIndex reader, const config::nfc::Reader &config);
 
   virtual ~NfcTags();
   NfcTags(const NfcTags &) = delete;
   NfcTags &operator=(const NfcTags &) = delete;
 
+  // Starts the worker, which resets the PN532 and then waits for the state
+  // to be loaded. Fails if the reader's USART does not exist, which marks
+  // the reader's BootStage right away.
+  Status Begin(std::shared_ptr<oww::state::State> state);
+
+  // Result of resetting the PN532, valid once the reader's BootStage is
+  // marked.
+  Status GetPcdStatus() const { return pcd_status_; }
+
+  // The PN532 is shared with MachineController, which drives a relay via P72.
+  // Usable once the reader's BootStage is marked and GetPcdStatus() is kOk.
+  std::shared_ptr<PN532> GetPcdInterface() { return pcd_interface_; }
+
+ private:
   static Logger logger;
+  const oww::state::ReaderIndex reader_;
   Thread *thread_ = nullptr;
   os_mutex_t mutex_ = 0;
 
+  // Wakes NfcThread from its sleep between two NfcLoop passes.
+  os_semaphore_t wake_ = nullptr;
+  // Bitmask of the targets whose awaited cloud response got completed since
+  // their last queued action, set from the cloud request's thread.
+  std::atomic<uint8_t> resumed_targets_ = 0;
+  static_assert(oww::state::max_targets <= 8);
+  // The PN532 got reset, which released all its targets.
+  bool pcd_reset_ = false;
+  std::atomic<Status> pcd_status_ = Status::kError;
+  TagSessionArbiter session_arbiter_;
+
   os_thread_return_t NfcThread();
 
+  void Wake();
+
  private:
   std::shared_ptr<oww::state::State> state_ = nullptr;
   std::shared_ptr<PN532> pcd_interface_;
-  std::shared_ptr<Ntag424> ntag_interface_;
+  // Tag session of each target, indexed by TargetIndex.
+  std::array<std::shared_ptr<Ntag424>, oww::state::max_targets>
+      ntag_interfaces_;
+  std::array<NfcStateData, oww::state::max_targets> targets_;
 
  private:
-  //  Main loop for NfcThread
-  void NfcLoop(NfcStateData &data);
+  // Main loop for a target in NfcThread. Returns the time in ms until the
+  // next pass is due, unless NfcThread is woken up earlier.
+  system_tick_t NfcLoop(NfcStateData &data);
+
+  // Lists the tags in the field, once all targets are released.
+  system_tick_t WaitForTags();
+
+  // Identifies a newly listed tag, which starts its tag session.
+  void DetectTag(NfcStateData &data);
 
-  void WaitForTag(NfcStateData &data);
+  // Ends the tag session of the target once its terminal state no longer
+  // needs the tag, i.e. no flow is in progress.
+  void UpdateTagSession(const NfcStateData &data);
 
   bool CheckTagStillAvailable(NfcStateData &data);
 
-  void TagPerformQueuedAction(NfcStateData &data);
+  // Returns to kWaitForTag and reports the tag as removed.
+  void ReleaseTarget(NfcStateData &data);
+
+  system_tick_t TagIdle(NfcStateData &data);
+
+  system_tick_t TagPerformQueuedAction(NfcStateData &data);
+
+  system_tick_t TagError(NfcStateData &data);
+
+ private:
+  // Time spent in a NfcState, split into CPU time and time asleep. Time
+  // asleep between two passes is accounted to the first active target.
+  struct StateStats {
+    uint64_t busy_us = 0;
+    uint64_t sleep_us = 0;
+    uint32_t passes = 0;
+  };
+
+  std::array<StateStats, 5> state_stats_;
+  system_tick_t state_stats_start_ = 0;
 
-  void TagError(NfcStateData &data);
+  void LogStateStats();
 };
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+// Decides which target of a PN532 may exchange frames with its tag.
+//
+// The PN532 selects a target before every exchange with it (InDataExchange,
+// InSelect, and thereby the presence checks), which deselects the previously
+// active target. A deselected NTAG 424 drops its selected application and
+// its authentication. So the tag session of a target, from identifying and
+// authenticating its tag until its flow no longer needs the tag, must not
+// be interleaved with exchanges of another target.
+//
+// The target with a session in progress holds the PN532; the other targets,
+// including their presence checks, wait until the session ended. Tags listed
+// together are identified one after another.
+//
+// Not thread safe, owned by the reader's worker.
+class TagSessionArbiter {
+ public:
+  // Whether the target may exchange frames with its tag now.
+  bool MayExchange(size_t target) const {
+    return !holder_ || *holder_ == target;
+  }
+
+  // Starts the session of a target, e.g. before identifying its tag. The
+  // target must be allowed to exchange frames.
+  void Begin(size_t target) { holder_ = target; }
+
+  // Ends the session of a target, once its flow no longer needs the tag or
+  // the tag got released. No-op if the target does not hold the PN532.
+  void End(size_t target) {
+    if (holder_ == target) holder_.reset();
+  }
+
+  std::optional<size_t> GetHolder() const { return holder_; }
+
+ private:
+  std::optional<size_t> holder_;
+};
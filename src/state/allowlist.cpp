@@ -0,0 +1,108 @@
+#include "allowlist.h"
+
+#include <algorithm>
+
+#include "common/byte_array.h"
+
+namespace oww::state {
+
+Logger Allowlist::logger("allowlist");
+
+Status Allowlist::Begin() {
+  auto ledger = Particle.ledger(allowlist_ledger_name);
+  ledger.onSync([this](Ledger ledger) { Load(ledger); });
+
+  if (!ledger.isValid()) {
+    logger.warn("Allowlist ledger is not valid, waiting for sync.");
+    return Status::kOk;
+  }
+
+  Load(ledger);
+  return Status::kOk;
+}
+
+Allowlist::Decision Allowlist::Check(const MachineConfig& machine,
+                                     const TagUid& uid) const {
+  auto index = std::atomic_load(&index_);
+
+  // Probe the denylist first, a revocation always wins over the allowlist.
+  if (index->revoked.MayContain(uid)) return Decision::kMaybeRevoked;
+
+  // The hash only narrows the search, ids with colliding hashes are told
+  // apart by comparing the id itself.
+  auto entry = std::lower_bound(
+      index->machines.begin(), index->machines.end(), machine.machine_id_hash,
+      [](auto& entry, uint32_t hash) { return entry.machine_id_hash < hash; });
+  for (; entry != index->machines.end() &&
+         entry->machine_id_hash == machine.machine_id_hash;
+       entry++) {
+    if (entry->machine_id == machine.machine_id) {
+      return entry->tags.Contains(uid) ? Decision::kAllowed
+                                       : Decision::kUnknown;
+    }
+  }
+
+  return Decision::kUnknown;
+}
+
+void Allowlist::Load(Ledger ledger) {
+  auto data = ledger.get();
+  auto index = std::make_shared<Index>();
+
+  auto machine_list = data.get("machine");
+  if (machine_list.isArray()) {
+    for (auto& machine_data : machine_list.asArray()) {
+      auto machine_id = machine_data.get("machineId");
+      if (!machine_id.isString()) {
+        logger.error("allowlist entry is missing [machineId]");
+        continue;
+      }
+
+      std::vector<TagUid> uids;
+      auto tags = machine_data.get("tags");
+      if (tags.isArray()) {
+        uids.reserve(tags.asArray().size());
+        for (auto& tag : tags.asArray()) {
+          auto uid = MakeBytesFromHexStringVariant<7>(tag);
+          if (!uid) {
+            logger.error("allowlist contains malformed tag UID");
+            continue;
+          }
+          uids.push_back(uid.value());
+        }
+      }
+
+      index->machines.push_back(MachineTags{
+          .machine_id_hash = HashMachineId(machine_id.asString().c_str()),
+          .machine_id = machine_id.asString(),
+          .tags = SortedUidSet(std::move(uids)),
+      });
+    }
+
+    std::sort(index->machines.begin(), index->machines.end(),
+              [](auto& a, auto& b) {
+                return a.machine_id_hash < b.machine_id_hash;
+              });
+  }
+
+  size_t revoked_count = 0;
+  auto revoked_list = data.get("revoked");
+  if (revoked_list.isArray()) {
+    for (auto& tag : revoked_list.asArray()) {
+      auto uid = MakeBytesFromHexStringVariant<7>(tag);
+      if (!uid) {
+        logger.error("denylist contains malformed tag UID");
+        continue;
+      }
+      index->revoked.Add(uid.value());
+      revoked_count++;
+    }
+  }
+
+  logger.info("Loaded allowlist for %u machines, %u revoked tags",
+              (unsigned)index->machines.size(), (unsigned)revoked_count);
+
+  std::atomic_store(&index_, std::shared_ptr<const Index>(std::move(index)));
+}
+
+}  // namespace oww::state
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "common.h"
+#include "common/uid_set.h"
+#include "configuration.h"
+
+namespace oww::state {
+
+constexpr auto allowlist_ledger_name = "terminal-allowlist";
+
+/**
+ * Local cache of the tags authorized on this terminal's machines, based on
+ * the allowlist device ledger.
+ *
+ * The ledger is synced by the cloud and persisted in flash by Device OS, so
+ * the allowlist is available right after boot, even without connectivity.
+ * Ledger format:
+ *
+ *   {
+ *     "machine": [{ "machineId": "...", "tags": ["04a1b2c3d4e5f6", ...] }],
+ *     "revoked": ["04a1b2c3d4e5f6", ...]
+ *   }
+ *
+ * A local decision is only ever used to power the machine early; the cloud
+ * stays authoritative and confirms each session asynchronously.
+ */
+class Allowlist {
+ public:
+  enum class Decision {
+    // Not on the allowlist, the cloud has to decide.
+    kUnknown = 0,
+    // On the allowlist and not revoked.
+    kAllowed = 1,
+    // Possibly revoked (the denylist is a Bloom filter, so this has false
+    // positives). The cloud has to decide.
+    kMaybeRevoked = 2,
+  };
+
+  Status Begin();
+
+  // Checks whether the tag may use the machine. Safe to call from any thread.
+  Decision Check(const MachineConfig& machine, const TagUid& uid) const;
+
+ private:
+  // ~2% false positives with up to 100 revoked tags, 128 bytes of RAM.
+  using Denylist = UidBloomFilter<1024, 4>;
+
+  struct MachineTags {
+    // HashMachineId() of machine_id, the sort key.
+    uint32_t machine_id_hash;
+    String machine_id;
+    SortedUidSet tags;
+  };
+
+  struct Index {
+    // Tags per machine, sorted by machine_id_hash.
+    std::vector<MachineTags> machines;
+    Denylist revoked;
+  };
+
+  static Logger logger;
+
+  // Replaced as a whole on ledger sync. Accessed via std::atomic_load/store.
+  std::shared_ptr<const Index> index_ = std::make_shared<const Index>();
+
+  void Load(Ledger ledger);
+};
+
+}  // namespace oww::state
@@ -4,11 +4,31 @@ namespace oww::state {
 
 Logger CloudRequest::logger("cloud_request");
 
+// Request ids of replayed requests, whose responses are not awaited.
+constexpr auto queued_request_prefix = "queued-";
+
 void CloudRequest::Begin() {
+  offline_queue_.Begin();
+  if (!config::cloud::replay_queued_requests) {
+    logger.warn("Replay of queued requests is disabled");
+  }
+
   Particle.function("TerminalResponse", &CloudRequest::HandleTerminalResponse,
                     this);
 }
 
+particle::Future<bool> CloudRequest::PublishTerminalRequest(
+    const String& command, const String& request_id, const uint8_t* data,
+    size_t size) {
+  auto base64_encoded_data = Base64::encodeToString(data, size);
+
+  String publish_payload =
+      String::format("%s,%s,%s", command.c_str(), request_id.c_str(),
+                     base64_encoded_data.c_str());
+
+  return Particle.publish("terminalRequest", publish_payload, WITH_ACK);
+}
+
 // std::shared_ptr<CloudResponse> CloudRequest::SendTerminalRequest(
 //     String command, Variant& payload, system_tick_t timeout_ms) {
 //   auto deadline = timeout_ms;
@@ -41,8 +61,11 @@ int CloudRequest::HandleTerminalResponse(String response_payload) {
   }
 
   auto request_id = response_payload.substring(0, id_end_index);
+  std::lock_guard<std::mutex> lock(inflight_mutex_);
   auto it = inflight_requests_.find(request_id);
   if (it == inflight_requests_.end()) {
+    if (request_id.startsWith(queued_request_prefix)) return 0;
+
     logger.error("Received response for unknown or timed-out request ID: %s",
                  request_id.c_str());
     return 0;
@@ -63,6 +86,7 @@ int CloudRequest::HandleTerminalResponse(String response_payload) {
       logger.error("Received error response for request %s",
                    request_id.c_str());
       inflight_request.failure_handler(ErrorType::kWrongState);
+      inflight_requests_.erase(it);
       return 0;
     } else {
       logger.error(
@@ -100,6 +124,7 @@ int CloudRequest::HandleTerminalResponse(String response_payload) {
 
 void CloudRequest::HandleTerminalFailure(String request_id,
                                          particle::Error error) {
+  std::lock_guard<std::mutex> lock(inflight_mutex_);
   auto it = inflight_requests_.find(request_id);
   if (it == inflight_requests_.end()) {
     logger.warn(
@@ -125,6 +150,7 @@ void CloudRequest::CheckTimeouts() {
   system_tick_t now = millis();
   std::vector<String> timed_out_ids;
 
+  std::lock_guard<std::mutex> lock(inflight_mutex_);
   for (auto const& [request_id, inflight_request] : inflight_requests_) {
     // Check if a deadline is set and if it has passed
     if (inflight_request.deadline != CONCURRENT_WAIT_FOREVER &&
@@ -143,4 +169,66 @@ void CloudRequest::CheckTimeouts() {
   }
 }
 
+void CloudRequest::ReplayQueuedRequests() {
+  using namespace config::cloud;
+  if (!replay_queued_requests || replay_pending_ > 0) return;
+
+  if (replay_batch_end_ != 0) {
+    if (replay_failed_) {
+      // The whole batch is published again, the cloud has to ignore
+      // duplicates.
+      logger.warn("Replay of queued requests failed, retrying");
+      next_replay_ = millis() + replay_retry_interval_ms;
+    } else {
+      offline_queue_.Commit(replay_batch_end_);
+    }
+    replay_batch_end_ = 0;
+    replay_failed_ = false;
+  }
+
+  if (!Particle.connected() ||
+      static_cast<int32_t>(millis() - next_replay_) < 0) {
+    return;
+  }
+
+  auto offset = offline_queue_.GetCursor();
+  size_t count = 0;
+  while (count < replay_batch_size && offline_queue_.HasRecord(offset)) {
+    auto next = offline_queue_.Read(offset, replay_record_);
+    if (!next) {
+      // The batch so far is replayed first. A corrupt record is dropped once
+      // it is the next one, an unreadable log is retried later.
+      if (count > 0) break;
+      if (next.error() == OfflineQueue::ReadError::kCorrupt) {
+        logger.error("Queued request at %lu is corrupt, dropping it", offset);
+        offline_queue_.DropCorrupt();
+      } else {
+        logger.warn("Queue is unreadable, retrying");
+        next_replay_ = millis() + replay_retry_interval_ms;
+      }
+      break;
+    }
+
+    auto request_id =
+        String::format("%s%lu", queued_request_prefix, offset);
+    replay_pending_++;
+    PublishTerminalRequest(replay_record_.command, request_id,
+                           replay_record_.payload.data(),
+                           replay_record_.payload_size)
+        .onSuccess([this](bool) { replay_pending_--; })
+        .onError([this](particle::Error error) {
+          replay_failed_ = true;
+          replay_pending_--;
+        });
+
+    offset = next.value();
+    count++;
+  }
+
+  if (count > 0) {
+    logger.info("Replaying %u queued requests", count);
+    replay_batch_end_ = offset;
+  }
+}
+
 }  // namespace oww::state
\ No newline at end of file
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <type_traits>
 
 #include "Base64RK.h"
 #include "cloud_response.h"
 #include "common.h"
 #include "flatbuffers/flatbuffers.h"
+#include "offline_queue.h"
+
 namespace oww::state {
 
 class CloudRequest {
@@ -20,6 +24,8 @@ class CloudRequest {
    * @param command The specific command or endpoint identifier for the request.
    * @param payload The request data payload.
    * @param timeout_ms Maximum time to wait for the response in milliseconds.
+   * @param on_completion Called once the response got completed, to resume
+   * the flow awaiting it.
    * @return std::shared_ptr<CloudResponse<TResponse>> A shared pointer to the
    * response object, which will be populated asynchronously upon success of
    * failure of the request.
@@ -27,7 +33,20 @@ class CloudRequest {
   template <typename TRequest, typename TResponse>
   std::shared_ptr<CloudResponse<TResponse>> SendTerminalRequest(
       String command, const TRequest& payload,
-      system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER);
+      system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER,
+      CompletionCallback on_completion = nullptr);
+
+  /**
+   * @brief Queues a request which needs no response, e.g. the end of a
+   * session. Queued requests are stored in flash and published once the
+   * cloud is reachable, possibly more than once. See
+   * config::cloud::replay_queued_requests.
+   *
+   * @param command The specific command or endpoint identifier for the request.
+   * @param payload The request data payload.
+   */
+  template <typename TRequest>
+  Status QueueTerminalRequest(String command, const TRequest& payload);
 
  private:
   struct InFlightRequest {
@@ -36,11 +55,28 @@ class CloudRequest {
     system_tick_t deadline = CONCURRENT_WAIT_FOREVER;
   };
 
+  // Guards request_counter_ and inflight_requests_. Requests are sent from
+  // the NfcTags threads of all readers, and completed from the system thread
+  // or timed out from the application thread.
+  std::mutex inflight_mutex_;
   // Counter to generate unique request IDs.
   int request_counter_ = 1;
   // Requests currently awaiting a response.
   std::map<String, InFlightRequest> inflight_requests_;
 
+  // Flash backed requests, and the batch of them being replayed.
+  OfflineQueue offline_queue_;
+  OfflineQueue::Record replay_record_;
+  uint32_t replay_batch_end_ = 0;
+  std::atomic<int> replay_pending_ = 0;
+  std::atomic<bool> replay_failed_ = false;
+  system_tick_t next_replay_ = 0;
+
+  particle::Future<bool> PublishTerminalRequest(const String& command,
+                                                const String& request_id,
+                                                const uint8_t* data,
+                                                size_t size);
+
   int HandleTerminalResponse(String response_payload);
   void HandleTerminalFailure(String request_id, particle::Error error);
 
@@ -49,11 +85,15 @@ class CloudRequest {
  protected:
   void Begin();
   void CheckTimeouts();
+  // Publishes the next batch of queued requests, once the previous one was
+  // acknowledged.
+  void ReplayQueuedRequests();
 };
 
 template <typename TRequest, typename TResponse>
 std::shared_ptr<CloudResponse<TResponse>> CloudRequest::SendTerminalRequest(
-    String command, const TRequest& payload, system_tick_t timeout_ms) {
+    String command, const TRequest& payload, system_tick_t timeout_ms,
+    CompletionCallback on_completion) {
   static_assert(
       std::is_class<TRequest>::value &&
           std::is_base_of<::flatbuffers::NativeTable, TRequest>::value,
@@ -75,11 +115,13 @@ std::shared_ptr<CloudResponse<TResponse>> CloudRequest::SendTerminalRequest(
   auto response_container =
       std::make_shared<CloudResponse<TResponse>>(Pending{});
 
+  std::unique_lock<std::mutex> lock(inflight_mutex_);
   String request_id = String::format("req-%d", request_counter_++);
 
   InFlightRequest pending_request = {
       .response_handler =
-          [response_container](const uint8_t* data, size_t size) {
+          [response_container, on_completion](const uint8_t* data,
+                                              size_t size) {
             TResponse deserialized_response;
             auto verifier = flatbuffers::Verifier(data, size);
 
@@ -92,29 +134,26 @@ std::shared_ptr<CloudResponse<TResponse>> CloudRequest::SendTerminalRequest(
               response_container->template emplace<ErrorType>(
                   ErrorType::kMalformedResponse);
             }
+            if (on_completion) on_completion();
           },
       .failure_handler =
-          [response_container](ErrorType error) {
+          [response_container, on_completion](ErrorType error) {
             response_container->template emplace<ErrorType>(error);
+            if (on_completion) on_completion();
           },
       .deadline = deadline_ticks,
   };
 
   inflight_requests_.emplace(request_id, std::move(pending_request));
+  // A failed publish may complete the request right away.
+  lock.unlock();
 
   flatbuffers::FlatBufferBuilder builder(400);
   auto payload_length = TRequestTable::Pack(builder, &payload);
   builder.Finish(payload_length);
 
-  auto base64_encoded_data =
-      Base64::encodeToString(builder.GetBufferPointer(), builder.GetSize());
-
-  String publish_payload =
-      String::format("%s,%s,%s", command.c_str(), request_id.c_str(),
-                     base64_encoded_data.c_str());
-
-  auto publish_future =
-      Particle.publish("terminalRequest", publish_payload, WITH_ACK);
+  auto publish_future = PublishTerminalRequest(
+      command, request_id, builder.GetBufferPointer(), builder.GetSize());
 
   publish_future.onError([this, request_id](particle::Error error) {
     // Call HandleTerminalFailure using the captured 'this' pointer and
@@ -124,4 +163,20 @@ std::shared_ptr<CloudResponse<TResponse>> CloudRequest::SendTerminalRequest(
 
   return response_container;  // Return the shared_ptr to the response struct
 }
+
+template <typename TRequest>
+Status CloudRequest::QueueTerminalRequest(String command,
+                                          const TRequest& payload) {
+  static_assert(
+      std::is_class<TRequest>::value &&
+          std::is_base_of<::flatbuffers::NativeTable, TRequest>::value,
+      "Type TRequest must be flatbuffer obj type");
+  using TRequestTable = typename TRequest::TableType;
+
+  flatbuffers::FlatBufferBuilder builder(256);
+  builder.Finish(TRequestTable::Pack(builder, &payload));
+
+  return offline_queue_.Append(command.c_str(), builder.GetBufferPointer(),
+                               builder.GetSize());
+}
 }  // namespace oww::state
\ No newline at end of file
@@ -9,6 +9,10 @@ struct Pending {};
 template <typename TResponse>
 using CloudResponse = std::variant<Pending, TResponse, ErrorType>;
 
+// Called once a CloudResponse got completed, by a response, a failure or a
+// timeout. Called from the system thread, so it must not block.
+using CompletionCallback = std::function<void()>;
+
 template <typename TResponse>
 bool IsSuccess(const CloudResponse<TResponse>& response) {
   return std::holds_alternative<TResponse>(response);
@@ -0,0 +1,172 @@
+#include "config_cache.h"
+
+#include <CRC32.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "fbs/config_cache_generated.h"
+
+namespace oww::state {
+
+Logger ConfigCache::logger("config");
+
+namespace {
+
+constexpr auto cache_path = "/usr/config_cache.bin";
+constexpr auto cache_temp_path = "/usr/config_cache.tmp";
+
+// "OWWC", little endian.
+constexpr uint32_t cache_magic = 0x4357574F;
+
+// The cache is a few hundred bytes, anything bigger is corrupt.
+constexpr uint32_t max_payload_size = 4096;
+
+struct CacheHeader {
+  uint32_t magic;
+  uint16_t format_version;
+  uint16_t reserved;
+  uint32_t payload_size;
+  uint32_t payload_crc;
+};
+
+}  // namespace
+
+std::shared_ptr<ConfigSnapshot> ConfigCache::Load() {
+  int fd = open(cache_path, O_RDONLY);
+  if (fd < 0) {
+    logger.info("No cached configuration");
+    return nullptr;
+  }
+
+  CacheHeader header;
+  std::unique_ptr<uint8_t[]> payload = nullptr;
+  bool read_ok = read(fd, &header, sizeof(header)) == sizeof(header) &&
+                 header.magic == cache_magic &&
+                 header.format_version == format_version &&
+                 header.payload_size <= max_payload_size;
+  if (read_ok) {
+    payload = std::make_unique<uint8_t[]>(header.payload_size);
+    read_ok = read(fd, payload.get(), header.payload_size) ==
+              (ssize_t)header.payload_size;
+  }
+  close(fd);
+
+  if (!read_ok) {
+    logger.warn("Cached configuration is unreadable or outdated");
+    return nullptr;
+  }
+
+  if (CRC32::calculate(payload.get(), header.payload_size) !=
+      header.payload_crc) {
+    logger.error("Cached configuration checksum mismatch");
+    return nullptr;
+  }
+
+  using namespace oww::config_cache;
+  auto verifier = flatbuffers::Verifier(payload.get(), header.payload_size);
+  if (!verifier.VerifyBuffer<Config>()) {
+    logger.error("Cached configuration is malformed");
+    return nullptr;
+  }
+
+  auto config = ::flatbuffers::GetRoot<Config>(payload.get());
+  auto snapshot = std::make_shared<ConfigSnapshot>();
+
+  if (auto terminal = config->terminal()) {
+    snapshot->terminal = std::make_shared<const TerminalConfig>(
+        terminal->machine_id() ? terminal->machine_id()->c_str() : "",
+        terminal->label() ? terminal->label()->c_str() : "");
+  }
+
+  if (auto machines = config->machine()) {
+    if (machines->size() > max_machines) {
+      logger.error("Cached configuration has too many machines");
+      return nullptr;
+    }
+
+    for (auto machine : *machines) {
+      auto control = static_cast<MachineControl>(machine->control());
+      if (control != MachineControl::kRelais0 &&
+          control != MachineControl::kRelais1) {
+        logger.error("Cached configuration has unknown control [%d]",
+                     machine->control());
+        return nullptr;
+      }
+
+      if (machine->reader() >= max_readers) {
+        logger.error("Cached configuration has unknown reader [%d]",
+                     machine->reader());
+        return nullptr;
+      }
+
+      snapshot->machines.push_back(std::make_shared<const MachineConfig>(
+          snapshot->machines.size(),
+          machine->machine_id() ? machine->machine_id()->c_str() : "", control,
+          machine->session_timeout_ms(), machine->reader()));
+    }
+  }
+
+  snapshot->is_configured = true;
+
+  return snapshot;
+}
+
+Status ConfigCache::Store(const ConfigSnapshot& snapshot) {
+  using namespace oww::config_cache;
+
+  flatbuffers::FlatBufferBuilder builder(256);
+
+  flatbuffers::Offset<Terminal> terminal = 0;
+  if (snapshot.terminal) {
+    terminal = CreateTerminalDirect(builder,
+                                    snapshot.terminal->machine_id.c_str(),
+                                    snapshot.terminal->label.c_str());
+  }
+
+  std::vector<flatbuffers::Offset<Machine>> machines;
+  for (auto& machine : snapshot.machines) {
+    machines.push_back(CreateMachineDirect(
+        builder, machine->machine_id.c_str(),
+        static_cast<uint8_t>(machine->control), machine->session_timeout_ms,
+        machine->reader));
+  }
+
+  builder.Finish(CreateConfigDirect(builder, terminal, &machines));
+
+  CacheHeader header{
+      .magic = cache_magic,
+      .format_version = format_version,
+      .reserved = 0,
+      .payload_size = builder.GetSize(),
+      .payload_crc =
+          CRC32::calculate(builder.GetBufferPointer(), builder.GetSize()),
+  };
+
+  // Write to a temporary file first, so a power loss never leaves a partial
+  // cache behind.
+  int fd = open(cache_temp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    logger.error("Unable to create configuration cache (errno %d)", errno);
+    return Status::kError;
+  }
+
+  bool write_ok =
+      write(fd, &header, sizeof(header)) == sizeof(header) &&
+      write(fd, builder.GetBufferPointer(), builder.GetSize()) ==
+          (ssize_t)builder.GetSize();
+  close(fd);
+
+  if (!write_ok || rename(cache_temp_path, cache_path) != 0) {
+    logger.error("Unable to write configuration cache");
+    unlink(cache_temp_path);
+    return Status::kError;
+  }
+
+  logger.info("Cached configuration version %d (%d bytes)", snapshot.version,
+              builder.GetSize());
+  return Status::kOk;
+}
+
+}  // namespace oww::state
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "common.h"
+#include "configuration.h"
+
+namespace oww::state {
+
+/**
+ * Persists the last applied ConfigSnapshot in flash, so the terminal is
+ * operational right after boot, before the ledger synced.
+ *
+ * The snapshot is stored as a config_cache flatbuffer, prefixed with a header
+ * holding the format version and a CRC32 of the payload. On load, the
+ * flatbuffer is read into a single buffer and accessed in place; there is no
+ * Variant or string based parsing involved.
+ */
+class ConfigCache {
+ public:
+  // Increment when the config_cache schema changes incompatibly.
+  static constexpr uint16_t format_version = 1;
+
+  // Loads the cached snapshot, or nullptr if there is no valid cache.
+  static std::shared_ptr<ConfigSnapshot> Load();
+
+  // Replaces the cached snapshot.
+  static Status Store(const ConfigSnapshot& snapshot);
+
+ private:
+  static Logger logger;
+};
+
+}  // namespace oww::state
@@ -1,6 +1,9 @@
 
 
 #include "configuration.h"
+
+#include "config_cache.h"
+
 namespace oww::state {
 
 // Factory data used for dev devices.
@@ -30,8 +33,35 @@ Logger logger("config");
 
 TerminalConfig::TerminalConfig(String machine_id, String label)
     : machine_id(machine_id), label(label) {}
-MachineConfig::MachineConfig(String machine_id, MachineControl control)
-    : machine_id(machine_id), control(control) {}
+
+uint32_t HashMachineId(const char* machine_id) {
+  uint32_t hash = 2166136261u;
+  for (auto c = machine_id; *c; c++) {
+    hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+  }
+  return hash;
+}
+
+MachineConfig::MachineConfig(MachineIndex index, String machine_id,
+                             MachineControl control,
+                             uint32_t session_timeout_ms, ReaderIndex reader)
+    : index(index),
+      machine_id(machine_id),
+      machine_id_hash(HashMachineId(machine_id.c_str())),
+      control(control),
+      session_timeout_ms(session_timeout_ms),
+      reader(reader) {}
+
+std::shared_ptr<const MachineConfig> ConfigSnapshot::FindMachine(
+    const char* machine_id) const {
+  auto hash = HashMachineId(machine_id);
+  for (auto& machine : machines) {
+    if (machine->machine_id_hash == hash && machine->machine_id == machine_id) {
+      return machine;
+    }
+  }
+  return nullptr;
+}
 
 Configuration::Configuration(std::weak_ptr<IStateEvent> event_sink)
     : event_sink_(event_sink) {}
@@ -56,67 +86,193 @@ Status Configuration::Begin() {
         "production keys.");
   }
 
+  // Start with the last known good configuration, the ledger is reconciled
+  // against it below or once it synced.
+  if (auto cached = ConfigCache::Load()) {
+    Apply(cached);
+  }
+
   auto ledger = Particle.ledger(ledger_name);
 
-  ledger.onSync(
-      [this](Ledger ledger) { event_sink_.lock()->OnConfigChanged(); });
+  ledger.onSync([this](Ledger ledger) { OnLedgerSync(ledger); });
 
   if (!ledger.isValid()) {
     logger.warn("Ledger is not valid, waiting for sync.");
     return Status::kOk;
   }
 
-  auto data = ledger.get();
+  auto snapshot = Parse(ledger.get());
+  if (!snapshot) {
+    return Status::kError;
+  }
+
+  if (Apply(snapshot) != 0) {
+    ConfigCache::Store(*GetSnapshot());
+  }
+
+  return Status::kOk;
+}
+
+void Configuration::OnLedgerSync(Ledger ledger) {
+  auto snapshot = Parse(ledger.get());
+  if (!snapshot) {
+    logger.error("Synced ledger is malformed, keeping current configuration");
+    return;
+  }
+
+  auto changes = Apply(snapshot);
+  if (changes == 0) {
+    logger.info("Ledger synced, configuration unchanged");
+    return;
+  }
+
+  ConfigCache::Store(*GetSnapshot());
+
+  if (auto event_sink = event_sink_.lock()) {
+    event_sink->OnConfigChanged(changes);
+  }
+}
+
+std::shared_ptr<ConfigSnapshot> Configuration::Parse(const LedgerData& data) {
+  auto snapshot = std::make_shared<ConfigSnapshot>();
+
   auto terminal_data = data.get("terminal");
   if (terminal_data.isMap()) {
     auto machine_id = terminal_data.get("machineId");
     if (!machine_id.isString()) {
       logger.error("terminal configuration is missing [machineId]");
-      return Status::kError;
+      return nullptr;
     }
 
     auto machine_name = terminal_data.get("machineName");
     if (!machine_name.isString()) {
       logger.error("terminal configuration is missing [machineName]");
-      return Status::kError;
+      return nullptr;
     }
 
-    terminal_config_ = std::make_unique<TerminalConfig>(
+    snapshot->terminal = std::make_shared<const TerminalConfig>(
         machine_id.asString(), machine_name.asString());
   }
 
   auto machine_list = data.get("machine");
-  if (machine_list.isArray() && machine_list.asArray().size() == 1) {
-    auto machine_data = machine_list.asArray().first();
+  if (machine_list.isArray() && machine_list.asArray().size() > max_machines) {
+    logger.error("machine configuration has more than %d machines",
+                 (int)max_machines);
+    return nullptr;
+  }
 
+  for (auto& machine_data : machine_list.asArray()) {
     auto machine_id = machine_data.get("machineId");
     if (!machine_id.isString()) {
       logger.error("machine configuration is missing [machineId]");
-      return Status::kError;
+      return nullptr;
+    }
+
+    // Also rejects distinct ids with colliding hashes, so FindMachine() is
+    // unambiguous.
+    if (snapshot->FindMachine(machine_id.asString().c_str())) {
+      logger.error("machine configuration has duplicate machine [%s]",
+                   machine_id.asString().c_str());
+      return nullptr;
     }
 
     auto control_string = machine_data.get("control");
     if (!control_string.isString()) {
       logger.error("machine configuration is missing [control]");
-      return Status::kError;
+      return nullptr;
     }
 
     MachineControl control = MachineControl::kUndefined;
     if (control_string.asString() == "relais-0") {
       control = MachineControl::kRelais0;
+    } else if (control_string.asString() == "relais-1") {
+      control = MachineControl::kRelais1;
     } else {
       logger.error("machine configuration unknown control [%s]",
                    control_string.asString().c_str());
-      return Status::kError;
+      return nullptr;
     }
 
-    machine_config_ =
-        std::make_unique<MachineConfig>(machine_id.asString(), control);
+    for (auto& other : snapshot->machines) {
+      if (other->control != control) continue;
+      logger.error("machine configuration has duplicate control [%s]",
+                   control_string.asString().c_str());
+      return nullptr;
+    }
+
+    // Optional, in seconds
+    uint32_t session_timeout_ms = 0;
+    auto session_timeout = machine_data.get("sessionTimeout");
+    if (session_timeout.isNumber()) {
+      session_timeout_ms = session_timeout.asUInt() * 1000;
+    }
+
+    // Optional, index into config::nfc::readers
+    ReaderIndex reader = 0;
+    auto reader_data = machine_data.get("reader");
+    if (reader_data.isNumber()) {
+      if (reader_data.asUInt() >= max_readers) {
+        logger.error("machine configuration unknown reader [%u]",
+                     reader_data.asUInt());
+        return nullptr;
+      }
+      reader = reader_data.asUInt();
+    }
+
+    snapshot->machines.push_back(std::make_shared<const MachineConfig>(
+        snapshot->machines.size(), machine_id.asString(), control,
+        session_timeout_ms, reader));
   }
 
-  is_configured_ = true;
+  snapshot->is_configured = true;
 
-  return Status::kOk;
+  return snapshot;
+}
+
+uint8_t Configuration::Apply(std::shared_ptr<ConfigSnapshot> snapshot) {
+  auto previous = GetSnapshot();
+  snapshot->version = previous->version + 1;
+
+  uint8_t changes = 0;
+
+  auto& old_terminal = previous->terminal;
+  auto& new_terminal = snapshot->terminal;
+  if (!old_terminal || !new_terminal) {
+    if (old_terminal != new_terminal) changes |= kConfigTerminalChanged;
+  } else if (old_terminal->machine_id != new_terminal->machine_id ||
+             old_terminal->label != new_terminal->label) {
+    changes |= kConfigTerminalChanged;
+  }
+
+  // Running sessions are re-bound to the new MachineConfig, or ended if their
+  // machine changed, see State::OnConfigChanged().
+  if (previous->machines.size() != snapshot->machines.size()) {
+    changes |= kConfigMachineChanged;
+  } else {
+    for (size_t i = 0; i < snapshot->machines.size(); i++) {
+      auto& old_machine = previous->machines[i];
+      auto& new_machine = snapshot->machines[i];
+      if (old_machine->machine_id_hash != new_machine->machine_id_hash ||
+          old_machine->machine_id != new_machine->machine_id ||
+          old_machine->control != new_machine->control ||
+          old_machine->session_timeout_ms != new_machine->session_timeout_ms ||
+          old_machine->reader != new_machine->reader) {
+        changes |= kConfigMachineChanged;
+      }
+    }
+  }
+
+  if (previous->is_configured != snapshot->is_configured) {
+    changes |= kConfigTerminalChanged | kConfigMachineChanged;
+  }
+
+  logger.info("Applying configuration version %d (changes: %#04x)",
+              snapshot->version, changes);
+
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const ConfigSnapshot>(std::move(snapshot)));
+
+  return changes;
 }
 
 bool Configuration::UsesDevKeys() {
@@ -2,6 +2,7 @@
 
 #include "common.h"
 #include "event/state_event.h"
+#include "reader.h"
 
 namespace oww::state {
 
@@ -22,11 +23,29 @@ enum class MachineControl {
   kRelais1 = 2,
 };
 
+// Index of a machine in ConfigSnapshot::machines.
+using MachineIndex = uint8_t;
+
+// Maximum number of machines gated by a single terminal.
+constexpr size_t max_machines = 4;
+
+// FNV-1a hash of a machine id, to skip most string compares on lookup. Equal
+// hashes don't imply equal ids.
+uint32_t HashMachineId(const char* machine_id);
+
 class MachineConfig {
  public:
-  MachineConfig(String machine_id, MachineControl control);
+  MachineConfig(MachineIndex index, String machine_id, MachineControl control,
+                uint32_t session_timeout_ms = 0, ReaderIndex reader = 0);
+  const MachineIndex index;
   const String machine_id;
+  const uint32_t machine_id_hash;
   const MachineControl control;
+  // How long a session continues after the tag was removed, e.g. to let a
+  // dust extractor run on. 0 ends the session with the tag removal.
+  const uint32_t session_timeout_ms;
+  // The reader on which a tap starts a session for this machine.
+  const ReaderIndex reader;
 };
 
 // Sensitive data stored in EEPROM in "factory", that is when assembling and
@@ -42,12 +61,40 @@ struct FactoryData {
   byte key[16];
 };
 
+// Immutable snapshot of the ledger based configuration.
+//
+// A new snapshot is created for every ledger sync, and swapped in as a whole.
+// Holders of a snapshot keep a consistent view, even while a newer one is
+// being applied.
+struct ConfigSnapshot {
+  // Incremented with every applied snapshot, starting at 1. Version 0 is the
+  // unconfigured state before the first ledger has been parsed.
+  uint32_t version = 0;
+  bool is_configured = false;
+  std::shared_ptr<const TerminalConfig> terminal = nullptr;
+  // Machines gated by this terminal, indexed by MachineIndex. Each machine
+  // has its own relay.
+  std::vector<std::shared_ptr<const MachineConfig>> machines;
+
+  // Returns the machine at index, or nullptr.
+  std::shared_ptr<const MachineConfig> GetMachine(MachineIndex index) const {
+    return index < machines.size() ? machines[index] : nullptr;
+  }
+
+  // Returns the machine with the given id, or nullptr. Compares the id
+  // hashes of at most max_machines entries, and the id itself on a match.
+  std::shared_ptr<const MachineConfig> FindMachine(
+      const char* machine_id) const;
+};
+
 /**
  * Terminal / machine based config, based on device ledger.
  *
- * The configuration is considered immutable. Once the ledger has been updated,
- * OnConfigChanged is dispatched and is expected to restart the device to catch
- * up with the newest config.
+ * Every ledger sync is parsed into a new ConfigSnapshot, which atomically
+ * replaces the current one. The last applied snapshot is kept in the
+ * ConfigCache, to be used on boot until the ledger is available.
+ * OnConfigChanged is dispatched with the parts that changed, all of which
+ * take effect without a restart.
  */
 class Configuration {
  public:
@@ -55,11 +102,20 @@ class Configuration {
 
   Status Begin();
 
-  bool IsConfigured() { return is_configured_; }
+  // Returns the current snapshot. Safe to call from any thread.
+  std::shared_ptr<const ConfigSnapshot> GetSnapshot() const {
+    return std::atomic_load(&snapshot_);
+  }
+
+  bool IsConfigured() { return GetSnapshot()->is_configured; }
 
-  TerminalConfig* GetTerminal() { return terminal_config_.get(); }
+  std::shared_ptr<const TerminalConfig> GetTerminal() {
+    return GetSnapshot()->terminal;
+  }
 
-  MachineConfig* GetMachine() { return machine_config_.get(); }
+  std::shared_ptr<const MachineConfig> GetMachine(MachineIndex index) {
+    return GetSnapshot()->GetMachine(index);
+  }
 
   // Whether development terminal keys are used.
   bool UsesDevKeys();
@@ -70,9 +126,18 @@ class Configuration {
   std::array<uint8_t, 16> terminal_key_;
   std::weak_ptr<IStateEvent> event_sink_;
 
-  bool is_configured_ = false;
-  std::unique_ptr<TerminalConfig> terminal_config_ = nullptr;
-  std::unique_ptr<MachineConfig> machine_config_ = nullptr;
+  std::shared_ptr<const ConfigSnapshot> snapshot_ =
+      std::make_shared<const ConfigSnapshot>();
+
+  // Parses the ledger into a new snapshot, returns nullptr if the ledger is
+  // malformed.
+  std::shared_ptr<ConfigSnapshot> Parse(const LedgerData& data);
+
+  // Swaps in a new snapshot and returns the ConfigChange bitmask against the
+  // previous one.
+  uint8_t Apply(std::shared_ptr<ConfigSnapshot> snapshot);
+
+  void OnLedgerSync(Ledger ledger);
 };
 
 }  // namespace oww::state
\ No newline at end of file
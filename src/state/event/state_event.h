@@ -5,17 +5,25 @@
 
 namespace oww::state::event {
 
+// Parts of the configuration that changed with a ledger sync, as bitmask.
+enum ConfigChange : uint8_t {
+  kConfigTerminalChanged = 1 << 0,
+  kConfigMachineChanged = 1 << 1,
+};
+
 class IStateEvent {
  public:
-  virtual void OnConfigChanged() = 0;
+  virtual void OnConfigChanged(uint8_t changes) = 0;
 
-  // NFC Events
+  // NFC Events, each for the reader and target the tag is presented on
   // A ISO tag found, not clear whether its the right tag, or its valid
-  virtual void OnTagFound() = 0;
-  virtual void OnBlankNtag(std::array<uint8_t, 7> uid) = 0;
-  virtual void OnTagAuthenicated(std::array<uint8_t, 7> uid) = 0;
-  virtual void OnUnknownTag() = 0;
-  virtual void OnTagRemoved() = 0;
+  virtual void OnTagFound(ReaderIndex reader, TargetIndex target) = 0;
+  virtual void OnBlankNtag(ReaderIndex reader, TargetIndex target,
+                           std::array<uint8_t, 7> uid) = 0;
+  virtual void OnTagAuthenicated(ReaderIndex reader, TargetIndex target,
+                                 std::array<uint8_t, 7> uid) = 0;
+  virtual void OnUnknownTag(ReaderIndex reader, TargetIndex target) = 0;
+  virtual void OnTagRemoved(ReaderIndex reader, TargetIndex target) = 0;
 
   virtual void OnNewState(oww::state::terminal::StartSession state) = 0;
   virtual void OnNewState(oww::state::terminal::Personalize state) = 0;
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "common.h"
+#include "common/uid_set.h"
+#include "cloud_response.h"
+#include "configuration.h"
+#include "fbs/session_generated.h"
+
+namespace oww::state {
+
+// A machine in use. The machine's relay is energized while the session is
+// active.
+struct MachineSession {
+  // The machine configuration the session was started with.
+  std::shared_ptr<const MachineConfig> machine;
+  TagUid tag_uid;
+  // Id of the session in the cloud, empty until the cloud authorized it.
+  std::string session_id;
+  // The cloud's answer to a locally authorized session, while its id is not
+  // known yet.
+  std::shared_ptr<CloudResponse<oww::session::StartSessionResponseT>>
+      start_response;
+  system_tick_t started_at;
+  // The session ends at this time, CONCURRENT_WAIT_FOREVER while the tag is
+  // present.
+  system_tick_t deadline = CONCURRENT_WAIT_FOREVER;
+
+  bool IsActive(system_tick_t now) const { return now < deadline; }
+};
+
+// Sessions of all machines, indexed by MachineIndex. Each machine has at
+// most one session, but the sessions of different machines run concurrently
+// (e.g. a dust extractor running on after its saw's session ended).
+using MachineSessions = std::array<std::optional<MachineSession>, max_machines>;
+
+}  // namespace oww::state
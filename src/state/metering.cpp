@@ -0,0 +1,223 @@
+#include "metering.h"
+
+#include <CRC32.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oww::state {
+
+Logger Metering::logger("metering");
+
+namespace {
+
+constexpr auto log_path = "/usr/metering.log";
+constexpr auto log_temp_path = "/usr/metering.tmp";
+
+struct Record {
+  // CRC32 of the remaining fields.
+  uint32_t crc;
+  uint8_t counter;
+  uint8_t reserved[3];
+  uint32_t machine_id_hash;
+  uint32_t seconds;
+};
+
+uint32_t CalculateCrc(const Record& record) {
+  return CRC32::calculate(reinterpret_cast<const uint8_t*>(&record.crc + 1),
+                          sizeof(Record) - sizeof(record.crc));
+}
+
+Record MakeRecord(uint8_t counter, uint32_t machine_id_hash,
+                  uint32_t seconds) {
+  Record record{
+      .crc = 0,
+      .counter = counter,
+      .reserved = {},
+      .machine_id_hash = machine_id_hash,
+      .seconds = seconds,
+  };
+  record.crc = CalculateCrc(record);
+  return record;
+}
+
+}  // namespace
+
+Status Metering::Begin() {
+  int fd = open(log_path, O_RDWR);
+  if (fd < 0) {
+    logger.info("No metering log");
+    return Status::kOk;
+  }
+
+  // Later records of a counter replace earlier ones. A power loss while
+  // flushing leaves a partial record at the end, which ends the log.
+  Record record;
+  while (read(fd, &record, sizeof(record)) == sizeof(record) &&
+         record.crc == CalculateCrc(record)) {
+    auto& entry =
+        GetEntry(static_cast<Counter>(record.counter), record.machine_id_hash);
+    entry.seconds = record.seconds;
+    log_size_ += sizeof(record);
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && (uint32_t)st.st_size > log_size_) {
+    logger.warn("Dropping %lu bytes of partial or corrupt metering records",
+                st.st_size - log_size_);
+    ftruncate(fd, log_size_);
+  }
+  close(fd);
+
+  for (auto& entry : entries_) {
+    if (entry.counter == Counter::kSessionRuntime && entry.seconds > 0) {
+      logger.info("Session on machine %08lx was interrupted after %lu s",
+                  entry.machine_id_hash, entry.seconds);
+    }
+  }
+
+  logger.info("Loaded %u metering counters", entries_.size());
+  return Status::kOk;
+}
+
+void Metering::Update(const MachineSessions& sessions, system_tick_t now) {
+  for (size_t i = 0; i < sessions.size(); i++) {
+    auto& session = sessions[i];
+    auto& tracked = tracked_[i];
+
+    std::optional<RuntimeMeter::Session> metered;
+    if (session) {
+      metered = RuntimeMeter::Session{
+          .tag_uid = session->tag_uid,
+          .started_at = session->started_at,
+          .deadline = session->deadline,
+      };
+    }
+
+    auto counted = tracked.meter.Update(metered, now);
+    AddRuntime(tracked.machine_id_hash, counted.ended_seconds);
+    if (!session) continue;
+
+    if (counted.started) {
+      tracked.machine_id_hash = session->machine->machine_id_hash;
+      Set(Counter::kSessionRuntime, tracked.machine_id_hash, 0);
+    }
+    AddRuntime(tracked.machine_id_hash, counted.seconds);
+  }
+
+  if (now - last_flush_ >= config::metering::flush_interval_ms) {
+    last_flush_ = now;
+    Flush();
+  }
+}
+
+uint32_t Metering::Get(Counter counter, uint32_t machine_id_hash) const {
+  for (auto& entry : entries_) {
+    if (entry.counter == counter && entry.machine_id_hash == machine_id_hash) {
+      return entry.seconds;
+    }
+  }
+  return 0;
+}
+
+Metering::Entry& Metering::GetEntry(Counter counter,
+                                    uint32_t machine_id_hash) {
+  for (auto& entry : entries_) {
+    if (entry.counter == counter && entry.machine_id_hash == machine_id_hash) {
+      return entry;
+    }
+  }
+  return entries_.emplace_back(Entry{
+      .counter = counter,
+      .machine_id_hash = machine_id_hash,
+      .seconds = 0,
+      .is_dirty = false,
+  });
+}
+
+void Metering::Set(Counter counter, uint32_t machine_id_hash,
+                   uint32_t seconds) {
+  auto& entry = GetEntry(counter, machine_id_hash);
+  if (entry.seconds == seconds) return;
+  entry.seconds = seconds;
+  entry.is_dirty = true;
+}
+
+void Metering::AddRuntime(uint32_t machine_id_hash, uint32_t seconds) {
+  if (seconds == 0) return;
+  Add(Counter::kMachineRuntime, machine_id_hash, seconds);
+  Add(Counter::kSessionRuntime, machine_id_hash, seconds);
+}
+
+void Metering::Add(Counter counter, uint32_t machine_id_hash,
+                   uint32_t seconds) {
+  auto& entry = GetEntry(counter, machine_id_hash);
+  entry.seconds += seconds;
+  entry.is_dirty = true;
+}
+
+Status Metering::Flush() {
+  std::vector<Record> records;
+  for (auto& entry : entries_) {
+    if (!entry.is_dirty) continue;
+    records.push_back(MakeRecord(static_cast<uint8_t>(entry.counter),
+                                 entry.machine_id_hash, entry.seconds));
+  }
+  if (records.empty()) return Status::kOk;
+
+  auto size = records.size() * sizeof(Record);
+  if (log_size_ + size > config::metering::max_log_size) {
+    return Compact();
+  }
+
+  int fd = open(log_path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (fd < 0) {
+    logger.error("Unable to open metering log (errno %d)", errno);
+    return Status::kError;
+  }
+
+  bool write_ok = write(fd, records.data(), size) == (ssize_t)size;
+  close(fd);
+
+  if (!write_ok) {
+    logger.error("Unable to write metering log");
+    return Status::kError;
+  }
+
+  log_size_ += size;
+  for (auto& entry : entries_) entry.is_dirty = false;
+  return Status::kOk;
+}
+
+Status Metering::Compact() {
+  std::vector<Record> records;
+  records.reserve(entries_.size());
+  for (auto& entry : entries_) {
+    records.push_back(MakeRecord(static_cast<uint8_t>(entry.counter),
+                                 entry.machine_id_hash, entry.seconds));
+  }
+
+  // Write to a temporary file first, so a power loss keeps the old log.
+  int fd = open(log_temp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    logger.error("Unable to create metering log (errno %d)", errno);
+    return Status::kError;
+  }
+
+  auto size = records.size() * sizeof(Record);
+  bool write_ok = write(fd, records.data(), size) == (ssize_t)size;
+  close(fd);
+
+  if (!write_ok || rename(log_temp_path, log_path) != 0) {
+    logger.error("Unable to compact metering log");
+    unlink(log_temp_path);
+    return Status::kError;
+  }
+
+  log_size_ = size;
+  for (auto& entry : entries_) entry.is_dirty = false;
+  return Status::kOk;
+}
+
+}  // namespace oww::state
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "common.h"
+#include "common/runtime_meter.h"
+#include "machine_session.h"
+
+namespace oww::state {
+
+/**
+ * Runtime of the machines, counted in seconds and persisted in flash.
+ *
+ * Counters are cached in RAM and only written every
+ * config::metering::flush_interval_ms. A flush appends a fixed size,
+ * CRC-protected record per changed counter to a log; on load, the last
+ * valid record of a counter wins, so a power loss while flushing loses at
+ * most the counts of that flush. Once the log is full, the current counters
+ * are written to a fresh log, which replaces the old one via rename.
+ * Appending instead of rewriting lets the file system spread the writes
+ * across flash.
+ *
+ * Not thread safe, to be called from the application thread.
+ */
+class Metering {
+ public:
+  enum class Counter : uint8_t {
+    // Total runtime of a machine.
+    kMachineRuntime = 1,
+    // Runtime of the current (or last) session of a machine.
+    kSessionRuntime = 2,
+  };
+
+  Status Begin();
+
+  // Counts the runtime of the active sessions up to now, and flushes the
+  // counters once the flush interval passed.
+  void Update(const MachineSessions& sessions, system_tick_t now);
+
+  // Returns a counter of the machine, in seconds.
+  uint32_t Get(Counter counter, uint32_t machine_id_hash) const;
+
+  // Writes the changed counters to flash.
+  Status Flush();
+
+ private:
+  static Logger logger;
+
+  struct Entry {
+    Counter counter;
+    uint32_t machine_id_hash;
+    uint32_t seconds;
+    bool is_dirty;
+  };
+
+  // Counters of all machines ever configured, including removed ones.
+  std::vector<Entry> entries_;
+  uint32_t log_size_ = 0;
+  system_tick_t last_flush_ = 0;
+
+  // Runtime per machine, and the machine the counted session was started
+  // on.
+  struct Tracked {
+    RuntimeMeter meter;
+    uint32_t machine_id_hash = 0;
+  };
+  std::array<Tracked, max_machines> tracked_;
+
+  void AddRuntime(uint32_t machine_id_hash, uint32_t seconds);
+
+  Entry& GetEntry(Counter counter, uint32_t machine_id_hash);
+  void Set(Counter counter, uint32_t machine_id_hash, uint32_t seconds);
+  void Add(Counter counter, uint32_t machine_id_hash, uint32_t seconds);
+
+  // Writes all counters to a fresh log.
+  Status Compact();
+};
+
+}  // namespace oww::state
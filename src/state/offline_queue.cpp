@@ -0,0 +1,311 @@
+#include "offline_queue.h"
+
+#include <CRC32.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oww::state {
+
+Logger OfflineQueue::logger("offline_queue");
+
+namespace {
+
+struct RecordHeader {
+  // CRC32 of the command and payload.
+  uint32_t crc;
+  uint16_t payload_size;
+  uint8_t command_size;
+  uint8_t reserved;
+};
+
+struct Cursor {
+  uint32_t offset;
+  // CRC32 of offset.
+  uint32_t crc;
+};
+
+bool IsValid(const RecordHeader& header) {
+  return header.command_size + header.payload_size <=
+         OfflineQueue::max_record_size;
+}
+
+uint32_t GetRecordSize(const RecordHeader& header) {
+  return sizeof(header) + header.command_size + header.payload_size;
+}
+
+uint32_t GetFileSize(const char* path) {
+  struct stat st;
+  return stat(path, &st) == 0 ? st.st_size : 0;
+}
+
+}  // namespace
+
+OfflineQueue::OfflineQueue(const char* directory)
+    : log_path_(String(directory) + "/offline_queue.bin"),
+      log_temp_path_(String(directory) + "/offline_queue.tmp"),
+      cursor_path_(String(directory) + "/offline_queue.pos"),
+      cursor_temp_path_(String(directory) + "/offline_queue.pos.tmp") {}
+
+Status OfflineQueue::Begin() {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  log_size_ = GetFileSize(log_path_.c_str());
+  cursor_ = 0;
+
+  int fd = open(cursor_path_.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    Cursor cursor;
+    if (read(fd, &cursor, sizeof(cursor)) == sizeof(cursor) &&
+        CRC32::calculate(&cursor.offset, sizeof(cursor.offset)) ==
+            cursor.crc &&
+        cursor.offset <= log_size_) {
+      cursor_ = cursor.offset;
+    } else {
+      logger.error("Replay cursor is corrupt, replaying the whole queue");
+    }
+    close(fd);
+  }
+
+  // A power loss while appending leaves a partial record at the end. Records
+  // after a corrupt one can't be located anymore and are dropped as well.
+  fd = open(log_path_.c_str(), O_RDWR);
+  if (fd < 0) return Status::kOk;
+
+  // Only a single record is held in RAM while scanning.
+  auto record = std::make_unique<Record>();
+  uint32_t offset = cursor_;
+  size_t count = 0;
+  bool corrupt = false;
+  while (offset < log_size_) {
+    auto next = ReadLocked(fd, offset, *record);
+    if (!next) {
+      corrupt = next.error() == ReadError::kCorrupt;
+      break;
+    }
+    offset = next.value();
+    count++;
+  }
+
+  if (corrupt) {
+    logger.warn("Dropping %lu bytes of partial or corrupt records",
+                log_size_ - offset);
+    ftruncate(fd, offset);
+    log_size_ = offset;
+  }
+  close(fd);
+
+  logger.info("%u queued requests to replay", count);
+  return Status::kOk;
+}
+
+Status OfflineQueue::Append(const char* command, const uint8_t* payload,
+                            size_t size) {
+  auto command_size = strlen(command);
+  if (command_size > UINT8_MAX || command_size + size > max_record_size) {
+    logger.error("Request %s is too big to be queued", command);
+    return Status::kError;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto record_size = sizeof(RecordHeader) + command_size + size;
+  if (log_size_ + record_size > max_log_size && cursor_ > 0) {
+    Compact();
+  }
+  if (log_size_ + record_size > max_log_size) {
+    logger.error("Queue is full, dropping request %s", command);
+    return Status::kError;
+  }
+
+  uint8_t buffer[sizeof(RecordHeader) + max_record_size];
+  auto data = buffer + sizeof(RecordHeader);
+  memcpy(data, command, command_size);
+  memcpy(data + command_size, payload, size);
+
+  RecordHeader header{
+      .crc = CRC32::calculate(data, command_size + size),
+      .payload_size = static_cast<uint16_t>(size),
+      .command_size = static_cast<uint8_t>(command_size),
+      .reserved = 0,
+  };
+  memcpy(buffer, &header, sizeof(header));
+
+  int fd = open(log_path_.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (fd < 0) {
+    logger.error("Unable to open queue (errno %d)", errno);
+    return Status::kError;
+  }
+
+  // A single write, so a power loss leaves at most one partial record.
+  bool write_ok = write(fd, buffer, record_size) == (ssize_t)record_size;
+  close(fd);
+
+  if (!write_ok) {
+    logger.error("Unable to queue request %s", command);
+    return Status::kError;
+  }
+
+  log_size_ += record_size;
+  return Status::kOk;
+}
+
+uint32_t OfflineQueue::GetCursor() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return base_ + cursor_;
+}
+
+bool OfflineQueue::HasRecord(uint32_t offset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return offset >= base_ && offset - base_ < log_size_;
+}
+
+tl::expected<uint32_t, OfflineQueue::ReadError> OfflineQueue::Read(
+    uint32_t offset, Record& record) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (offset < base_) return tl::unexpected(ReadError::kUnavailable);
+
+  int fd = open(log_path_.c_str(), O_RDONLY);
+  if (fd < 0) return tl::unexpected(ReadError::kUnavailable);
+
+  auto result = ReadLocked(fd, offset - base_, record);
+  close(fd);
+  if (!result) return result;
+  return base_ + result.value();
+}
+
+tl::expected<uint32_t, OfflineQueue::ReadError> OfflineQueue::ReadLocked(
+    int fd, uint32_t offset, Record& record) {
+  // Records lie within log_size_, so reading less is a partial record.
+  RecordHeader header;
+  if (lseek(fd, offset, SEEK_SET) != (off_t)offset) {
+    return tl::unexpected(ReadError::kUnavailable);
+  }
+  if (read(fd, &header, sizeof(header)) != sizeof(header) ||
+      !IsValid(header) || offset + GetRecordSize(header) > log_size_) {
+    return tl::unexpected(ReadError::kCorrupt);
+  }
+
+  char command[UINT8_MAX + 1];
+  if (read(fd, command, header.command_size) != header.command_size ||
+      read(fd, record.payload.data(), header.payload_size) !=
+          header.payload_size) {
+    return tl::unexpected(ReadError::kCorrupt);
+  }
+
+  CRC32 crc;
+  crc.update(command, header.command_size);
+  crc.update(record.payload.data(), header.payload_size);
+  if (crc.finalize() != header.crc) {
+    return tl::unexpected(ReadError::kCorrupt);
+  }
+
+  command[header.command_size] = 0;
+  record.command = command;
+  record.payload_size = header.payload_size;
+
+  return offset + sizeof(header) + header.command_size + header.payload_size;
+}
+
+Status OfflineQueue::Commit(uint32_t offset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return CommitLocked(offset);
+}
+
+Status OfflineQueue::DropCorrupt() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (cursor_ >= log_size_) return Status::kOk;
+
+  int fd = open(log_path_.c_str(), O_RDONLY);
+  if (fd < 0) return Status::kError;
+
+  RecordHeader header;
+  bool header_ok = lseek(fd, cursor_, SEEK_SET) == (off_t)cursor_ &&
+                   read(fd, &header, sizeof(header)) == sizeof(header) &&
+                   IsValid(header) &&
+                   cursor_ + GetRecordSize(header) <= log_size_;
+  close(fd);
+
+  uint32_t next = header_ok ? cursor_ + GetRecordSize(header) : log_size_;
+  logger.warn("Dropping %lu bytes of corrupt records", next - cursor_);
+  return CommitLocked(base_ + next);
+}
+
+Status OfflineQueue::CommitLocked(uint32_t offset) {
+  if (offset <= base_ + cursor_) return Status::kOk;
+
+  cursor_ = std::min(offset - base_, log_size_);
+  if (cursor_ < log_size_) return StoreCursor();
+
+  // Fully replayed, start over with an empty log.
+  unlink(log_path_.c_str());
+  unlink(cursor_path_.c_str());
+  base_ += log_size_;
+  cursor_ = 0;
+  log_size_ = 0;
+  return Status::kOk;
+}
+
+Status OfflineQueue::StoreCursor() {
+  Cursor cursor{
+      .offset = cursor_,
+      .crc = CRC32::calculate(&cursor_, sizeof(cursor_)),
+  };
+
+  int fd =
+      open(cursor_temp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    logger.error("Unable to store replay cursor (errno %d)", errno);
+    return Status::kError;
+  }
+
+  bool write_ok = write(fd, &cursor, sizeof(cursor)) == sizeof(cursor);
+  close(fd);
+
+  if (!write_ok ||
+      rename(cursor_temp_path_.c_str(), cursor_path_.c_str()) != 0) {
+    logger.error("Unable to store replay cursor");
+    unlink(cursor_temp_path_.c_str());
+    return Status::kError;
+  }
+
+  return Status::kOk;
+}
+
+Status OfflineQueue::Compact() {
+  int in = open(log_path_.c_str(), O_RDONLY);
+  int out =
+      open(log_temp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool copy_ok = in >= 0 && out >= 0 &&
+                 lseek(in, cursor_, SEEK_SET) == (off_t)cursor_;
+
+  uint8_t chunk[256];
+  ssize_t chunk_size;
+  while (copy_ok && (chunk_size = read(in, chunk, sizeof(chunk))) > 0) {
+    copy_ok = write(out, chunk, chunk_size) == chunk_size;
+  }
+
+  if (in >= 0) close(in);
+  if (out >= 0) close(out);
+
+  // The cursor is reset before the log is replaced. A power loss in between
+  // replays the already replayed records again, rather than skipping any.
+  auto cursor = cursor_;
+  cursor_ = 0;
+  if (!copy_ok || StoreCursor() != Status::kOk ||
+      rename(log_temp_path_.c_str(), log_path_.c_str()) != 0) {
+    logger.error("Unable to compact queue");
+    unlink(log_temp_path_.c_str());
+    cursor_ = cursor;
+    StoreCursor();
+    return Status::kError;
+  }
+
+  logger.info("Compacted queue by %lu bytes", cursor);
+  base_ += cursor;
+  log_size_ -= cursor;
+  return Status::kOk;
+}
+
+}  // namespace oww::state
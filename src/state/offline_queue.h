@@ -0,0 +1,97 @@
+#pragma once
+
+#include <mutex>
+
+#include "Particle.h"
+#include "common/expected.h"
+#include "common/status.h"
+
+namespace oww::state {
+
+/**
+ * Flash backed, append-only queue of terminal requests which do not need an
+ * answer, e.g. the end of a session. Requests survive a restart and are
+ * replayed once the cloud is reachable again.
+ *
+ * Each record is a fixed header holding a CRC32, followed by the command
+ * and the flatbuffer payload. Records before the replay cursor are done; the
+ * cursor is persisted separately, and the log is deleted once it got fully
+ * replayed. Records are read one at a time into a fixed buffer, so the RAM
+ * footprint does not depend on the queue length.
+ *
+ * Thread safe.
+ */
+class OfflineQueue {
+ public:
+  // Maximum size of the command and payload of a single record.
+  static constexpr size_t max_record_size = 512;
+  // The log is compacted, respectively new records are dropped, beyond this
+  // size.
+  static constexpr uint32_t max_log_size = 32 * 1024;
+
+  struct Record {
+    String command;
+    std::array<uint8_t, max_record_size> payload;
+    size_t payload_size = 0;
+  };
+
+  enum class ReadError {
+    // The log could not be read, e.g. the file system is busy. A later read
+    // may succeed.
+    kUnavailable = 1,
+    // The record failed its checksum or has an invalid header.
+    kCorrupt = 2,
+  };
+
+  // Args:
+  //   directory: Where the log and the replay cursor are stored.
+  explicit OfflineQueue(const char* directory = "/usr");
+
+  // Loads the cursor, and drops a partial record left by a power loss.
+  Status Begin();
+
+  Status Append(const char* command, const uint8_t* payload, size_t size);
+
+  // Offset of the first record not replayed yet. Offsets stay valid while
+  // the log is compacted.
+  uint32_t GetCursor();
+
+  // Whether there is a record at offset.
+  bool HasRecord(uint32_t offset);
+
+  // Reads the record at offset. Returns the offset of the next record.
+  tl::expected<uint32_t, ReadError> Read(uint32_t offset, Record& record);
+
+  // Marks all records before offset as replayed.
+  Status Commit(uint32_t offset);
+
+  // Drops the record at the cursor, after Read found it corrupt. If its
+  // header is corrupt as well, the records after it can't be located and
+  // are dropped too.
+  Status DropCorrupt();
+
+ private:
+  static Logger logger;
+
+  const String log_path_;
+  const String log_temp_path_;
+  const String cursor_path_;
+  const String cursor_temp_path_;
+
+  std::mutex mutex_;
+  // Position in the log file.
+  uint32_t cursor_ = 0;
+  uint32_t log_size_ = 0;
+  // Bytes removed from the start of the log since Begin(). Offsets passed to
+  // callers are positions in the log file plus base_.
+  uint32_t base_ = 0;
+
+  tl::expected<uint32_t, ReadError> ReadLocked(int fd, uint32_t offset,
+                                               Record& record);
+  Status CommitLocked(uint32_t offset);
+  Status StoreCursor();
+  // Moves the records after the cursor to the start of the log.
+  Status Compact();
+};
+
+}  // namespace oww::state
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "common.h"
+
+namespace oww::state {
+
+// Index of a NFC reader in config::nfc::readers.
+using ReaderIndex = uint8_t;
+
+constexpr size_t max_readers = std::size(config::nfc::readers);
+
+// Index of a tag among the targets listed by a reader.
+using TargetIndex = uint8_t;
+
+// See config::nfc::max_targets.
+constexpr size_t max_targets = config::nfc::max_targets;
+
+}  // namespace oww::state
@@ -1,80 +1,479 @@
 
 #include "state.h"
 
+#include "common/boot_timeline.h"
 #include "common/byte_array.h"
+#include "fbs/end_session_generated.h"
+#include "fbs/session_generated.h"
 
 namespace oww::state {
 
 Logger State::logger("state");
 
-Status State::Begin(std::unique_ptr<Configuration> configuration) {
-  os_mutex_create(&mutex_);
+terminal::StatePool &terminal::GetStatePool() {
+  static StatePool pool;
+  return pool;
+}
 
+Status State::Begin(std::unique_ptr<Configuration> configuration) {
   configuration_ = std::move(configuration);
   configuration_->Begin();
 
-  terminal_state_ = std::make_shared<terminal::State>(terminal::Idle{});
+  allowlist_ = std::make_unique<Allowlist>();
+  allowlist_->Begin();
+
+  metering_.Begin();
 
   CloudRequest::Begin();
 
+  BootTimeline::instance().Mark(BootStage::kState);
   return Status::kOk;
 }
 
-void State::Loop() { CheckTimeouts(); }
+void State::Loop() {
+  CheckTimeouts();
+  ReplayQueuedRequests();
+  auto now = millis();
+  // Counts expired sessions up to their deadline, before they are removed.
+  metering_.Update(*machine_sessions_.Get(), now);
+  EndExpiredSessions(now);
+  ReportPendingSessionEnds();
+}
+
+void State::OnConfigChanged(uint8_t changes) {
+  logger.info("Configuration changed (changes: %#04x)", changes);
+
+  // The MachineController follows the published sessions, the UI is woken up
+  // for the terminal changes.
+  if (changes & kConfigMachineChanged) RebindMachineSessions();
+  display_changes_.Notify();
+}
+
+void State::PublishTerminalState(ReaderIndex reader, TargetIndex target,
+                                 std::shared_ptr<terminal::State> state) {
+  auto is_idle = std::holds_alternative<terminal::Idle>(*state);
+  tag_slots_[reader][target].terminal_state.Publish(state);
 
-void State::OnConfigChanged() { System.reset(RESET_REASON_CONFIG_UPDATE); }
+  // The display stays with the tag presented last, until another tag is
+  // presented.
+  std::lock_guard<std::mutex> lock(display_mutex_);
+  if (reader != displayed_reader_ || target != displayed_target_) {
+    if (is_idle) return;
+    displayed_reader_ = reader;
+    displayed_target_ = target;
+  }
+  terminal_state_.Publish(std::move(state));
+  display_changes_.Notify();
+}
 
-void State::OnTagFound() {
-  logger.info("tag_state: OnTagFound");
+void State::OnTagFound(ReaderIndex reader, TargetIndex target) {
+  logger.info("tag_state: OnTagFound (reader %d, target %d)", reader, target);
 
-  terminal_state_ = std::make_shared<terminal::State>(terminal::Detected{});
+  tag_slots_[reader][target].tap_start_stats =
+      terminal::GetStatePool().GetStats();
+  PublishTerminalState(
+      reader, target,
+      terminal::MakeState<terminal::State>(terminal::Detected{}));
 }
 
-void State::OnBlankNtag(std::array<uint8_t, 7> uid) {
-  logger.info("tag_state: OnBlankNtag");
+void State::OnBlankNtag(ReaderIndex reader, TargetIndex target,
+                        std::array<uint8_t, 7> uid) {
+  logger.info("tag_state: OnBlankNtag (reader %d, target %d)", reader,
+              target);
 
   OnNewState(terminal::Personalize{
       .tag_uid = uid,
-      .state = std::make_shared<terminal::personalize::State>(
+      .reader = reader,
+      .target = target,
+      .state = terminal::MakeState<terminal::personalize::State>(
           terminal::personalize::Wait{
               .timeout = millis() + 3000,
           })});
 }
 
-void State::OnTagAuthenicated(std::array<uint8_t, 7> uid) {
-  logger.info("tag_state: OnTagAuthenicated");
+void State::OnTagAuthenicated(ReaderIndex reader, TargetIndex target,
+                              std::array<uint8_t, 7> uid) {
+  logger.info("tag_state: OnTagAuthenicated (reader %d, target %d)", reader,
+              target);
 
   // TODO:
   // - check tap-out
-  // - check pre-authorized.
 
+  tag_slots_[reader][target].tag_uid = uid;
+
+  // A tap starts a session on each machine served by the reader, one after
+  // another until one does not succeed, see OnNewState().
   OnNewState(
-      terminal::StartSession{.tag_uid = uid,
-                             .state = std::make_shared<terminal::start::State>(
-                                 terminal::start::StartWithNfcAuth{})});
+      NewStartSession(reader, target, uid, NextMachine(reader, nullptr)));
+}
+
+std::shared_ptr<const MachineConfig> State::NextMachine(
+    ReaderIndex reader, const MachineConfig *after) {
+  auto config = configuration_->GetSnapshot();
+  for (auto &machine : config->machines) {
+    if (machine->reader != reader) continue;
+    if (after && machine->index <= after->index) continue;
+    return machine;
+  }
+  return nullptr;
+}
+
+bool State::IsMachineInUse(const MachineConfig &machine, const TagUid &uid) {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto &session = (*machine_sessions_.Get())[machine.index];
+  return session && session->tag_uid != uid &&
+         session->deadline == CONCURRENT_WAIT_FOREVER;
+}
+
+terminal::StartSession State::NewStartSession(
+    ReaderIndex reader, TargetIndex target, const TagUid &uid,
+    std::shared_ptr<const MachineConfig> machine) {
+  // A machine has a single session. Another tag presented while the tag of
+  // the session is still present must not take the session over, so it is
+  // rejected without asking the cloud.
+  if (machine && IsMachineInUse(*machine, uid)) {
+    logger.warn("tag_state: Machine %d is in use by another tag",
+                machine->index);
+    return terminal::StartSession{
+        .tag_uid = uid,
+        .reader = reader,
+        .target = target,
+        .machine = std::move(machine),
+        .locally_authorized = false,
+        .state = terminal::MakeState<terminal::start::State>(
+            terminal::start::Failed{
+                .error = ErrorType::kWrongState,
+                .message = "Machine in use by another tag"})};
+  }
+
+  std::optional<std::string> recent_auth_token;
+  if (machine) {
+    std::lock_guard<std::mutex> lock(recent_auth_mutex_);
+    recent_auth_token =
+        recent_auth_.Lookup(machine->machine_id_hash, uid, millis());
+  }
+
+  // Tags on the local allowlist, or with a recent session on the machine,
+  // power the machine right away. The cloud confirms the session in the
+  // background.
+  auto locally_authorized =
+      recent_auth_token.has_value() ||
+      (machine &&
+       allowlist_->Check(*machine, uid) == Allowlist::Decision::kAllowed);
+  if (recent_auth_token) {
+    logger.info("tag_state: Tag had a recent session on machine %d",
+                machine->index);
+  } else if (locally_authorized) {
+    logger.info("tag_state: Tag is on local allowlist for machine %d",
+                machine->index);
+  }
+
+  auto state =
+      recent_auth_token
+          ? terminal::MakeState<terminal::start::State>(
+                terminal::start::StartWithRecentAuth{
+                    .recent_auth_token = recent_auth_token->c_str()})
+          : terminal::MakeState<terminal::start::State>(
+                terminal::start::StartWithNfcAuth{});
+
+  return terminal::StartSession{
+      .tag_uid = uid,
+      .reader = reader,
+      .target = target,
+      .machine = std::move(machine),
+      .locally_authorized = locally_authorized,
+      .state = std::move(state)};
+}
+
+void State::UpdateRecentAuth(const terminal::StartSession &state) {
+  using namespace terminal::start;
+  if (!state.machine) return;
+
+  auto hash = state.machine->machine_id_hash;
+  std::lock_guard<std::mutex> lock(recent_auth_mutex_);
+  if (auto succeeded = std::get_if<Succeeded>(state.state.get())) {
+    recent_auth_.Store(hash, state.tag_uid, succeeded->session_id, millis());
+  } else if (std::holds_alternative<Rejected>(*state.state)) {
+    recent_auth_.Erase(hash, state.tag_uid, millis());
+  }
 }
 
-void State::OnUnknownTag() {
-  logger.info("tag_state: OnUnknownTag");
+void State::UpdateMachineSession(const terminal::StartSession &state) {
+  if (!state.machine) return;
+
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto sessions = std::make_shared<MachineSessions>(*machine_sessions_.Get());
+  auto &session = (*sessions)[state.machine->index];
+  auto is_tag_session = session && session->tag_uid == state.tag_uid &&
+                        session->deadline == CONCURRENT_WAIT_FOREVER;
+
+  auto succeeded = std::get_if<terminal::start::Succeeded>(state.state.get());
+
+  auto awaiting = std::get_if<terminal::start::AwaitStartSessionResponse>(
+      state.state.get());
 
-  terminal_state_ = std::make_shared<terminal::State>(terminal::Unknown{});
+  if (terminal::IsAuthorized(state)) {
+    if (is_tag_session) {
+      // A local authorization the cloud is asked to confirm, respectively
+      // confirmed. A different session of the cloud means the tag got
+      // authenticated again (e.g. retried after a tag error), the new
+      // session replaces the previous one below.
+      if (awaiting) {
+        if (session->start_response == awaiting->response) return;
+        if (!session->start_response && session->session_id.empty()) {
+          session->start_response = awaiting->response;
+          machine_sessions_.Publish(std::move(sessions));
+          return;
+        }
+      } else if (succeeded) {
+        if (session->session_id == succeeded->session_id) return;
+        if (session->session_id.empty()) {
+          session->session_id = succeeded->session_id;
+          session->start_response = nullptr;
+          machine_sessions_.Publish(std::move(sessions));
+          return;
+        }
+      } else {
+        return;
+      }
+    } else if (session && session->deadline == CONCURRENT_WAIT_FOREVER) {
+      // Another tag takes over the machine, once the tag of its session got
+      // removed (see NewStartSession()).
+      logger.error("tag_state: Machine %d is in use by another tag",
+                   state.machine->index);
+      // The cloud started a session meanwhile, end it right away.
+      if (succeeded) {
+        auto now = millis();
+        ReportSessionEnd(MachineSession{.machine = state.machine,
+                                        .tag_uid = state.tag_uid,
+                                        .session_id = succeeded->session_id,
+                                        .started_at = now},
+                         now);
+      }
+      return;
+    }
+
+    // The previous session, possibly still in its timeout, ends now.
+    auto now = millis();
+    if (session) {
+      ReportSessionEnd(*session, std::min(now, session->deadline));
+    }
+    session = MachineSession{
+        .machine = state.machine,
+        .tag_uid = state.tag_uid,
+        .session_id = succeeded ? succeeded->session_id : "",
+        .start_response = awaiting ? awaiting->response : nullptr,
+        .started_at = now,
+    };
+  } else if (is_tag_session &&
+             std::holds_alternative<terminal::start::Rejected>(*state.state)) {
+    // A local authorization the cloud rejected. A session the cloud
+    // confirmed before (on an earlier authentication) is reported as ended.
+    ReportSessionEnd(*session, millis());
+    session.reset();
+  } else {
+    return;
+  }
+
+  machine_sessions_.Publish(std::move(sessions));
 }
 
-void State::OnTagRemoved() {
-  logger.info("tag_state: OnTagRemoved");
+void State::EndTagSessions(ReaderIndex reader, const TagUid &uid) {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto sessions = std::make_shared<MachineSessions>(*machine_sessions_.Get());
+  auto changed = false;
+
+  for (auto &session : *sessions) {
+    if (!session || session->machine->reader != reader ||
+        session->tag_uid != uid ||
+        session->deadline != CONCURRENT_WAIT_FOREVER) {
+      continue;
+    }
+
+    // A session with a timeout is reported once it expired or got taken
+    // over, see EndExpiredSessions() and UpdateMachineSession().
+    auto now = millis();
+    if (session->machine->session_timeout_ms == 0) {
+      ReportSessionEnd(*session, now);
+      session.reset();
+    } else {
+      session->deadline = now + session->machine->session_timeout_ms;
+    }
+    changed = true;
+  }
 
-  terminal_state_ = std::make_shared<terminal::State>(terminal::Idle{});
+  if (changed) machine_sessions_.Publish(std::move(sessions));
+}
+
+void State::ReportSessionEnd(const MachineSession &session,
+                             system_tick_t ended_at) {
+  auto duration_ms = ended_at - session.started_at;
+  if (session.session_id.empty() && session.start_response) {
+    pending_session_ends_.push_back(PendingSessionEnd{
+        .machine = session.machine,
+        .tag_uid = session.tag_uid,
+        .start_response = session.start_response,
+        .duration_ms = duration_ms,
+    });
+    return;
+  }
+
+  QueueSessionEnd(session.session_id, *session.machine, session.tag_uid,
+                  duration_ms);
+}
+
+void State::QueueSessionEnd(const std::string &session_id,
+                            const MachineConfig &machine, const TagUid &uid,
+                            uint32_t duration_ms) {
+  oww::session::EndSessionRequestT request;
+  request.session_id = session_id;
+  request.duration_ms = duration_ms;
+  request.token_id = std::make_unique<oww::ntag::TagUid>(
+      flatbuffers::span<const uint8_t, 7>(uid));
+  request.machine_id = machine.machine_id.c_str();
+  QueueTerminalRequest("endSession", request);
+}
+
+void State::EndExpiredSessions(system_tick_t now) {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto current = machine_sessions_.Get();
+  std::shared_ptr<MachineSessions> sessions;
+
+  for (size_t i = 0; i < current->size(); i++) {
+    auto &session = (*current)[i];
+    if (!session || session->IsActive(now)) continue;
+
+    if (!sessions) sessions = std::make_shared<MachineSessions>(*current);
+    ReportSessionEnd(*session, session->deadline);
+    (*sessions)[i].reset();
+  }
+
+  if (sessions) machine_sessions_.Publish(std::move(sessions));
+}
+
+void State::RebindMachineSessions() {
+  auto config = configuration_->GetSnapshot();
+
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto current = machine_sessions_.Get();
+  auto sessions = std::make_shared<MachineSessions>(*current);
+  auto now = millis();
+
+  for (size_t i = 0; i < sessions->size(); i++) {
+    auto &session = (*sessions)[i];
+    if (!session) continue;
+
+    auto machine = config->GetMachine(i);
+    if (machine && machine->machine_id == session->machine->machine_id &&
+        machine->reader == session->machine->reader &&
+        machine->control == session->machine->control) {
+      // A changed timeout applies from the next removal of the tag on, a
+      // running timeout keeps its deadline.
+      session->machine = std::move(machine);
+      continue;
+    }
+
+    logger.info("Machine %s changed, ending its session",
+                session->machine->machine_id.c_str());
+    ReportSessionEnd(*session, std::min(now, session->deadline));
+    session.reset();
+  }
+
+  machine_sessions_.Publish(std::move(sessions));
+}
+
+void State::ReportPendingSessionEnds() {
+  using oww::session::AuthorizationResult;
+  using oww::session::StartSessionResponseT;
+
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  for (auto it = pending_session_ends_.begin();
+       it != pending_session_ends_.end();) {
+    if (IsPending(*it->start_response)) {
+      it++;
+      continue;
+    }
+
+    // A session the cloud authorized is reported with its id, one whose
+    // start failed (e.g. while offline) without. Nothing to report if the
+    // cloud rejected it.
+    auto response = std::get_if<StartSessionResponseT>(it->start_response.get());
+    if (!response) {
+      QueueSessionEnd("", *it->machine, it->tag_uid, it->duration_ms);
+    } else if (response->result.type == AuthorizationResult::StateAuthorized) {
+      QueueSessionEnd(response->session_id, *it->machine, it->tag_uid,
+                      it->duration_ms);
+    }
+    it = pending_session_ends_.erase(it);
+  }
+}
+
+void State::OnUnknownTag(ReaderIndex reader, TargetIndex target) {
+  logger.info("tag_state: OnUnknownTag (reader %d, target %d)", reader,
+              target);
+
+  PublishTerminalState(
+      reader, target,
+      terminal::MakeState<terminal::State>(terminal::Unknown{}));
+}
+
+void State::OnTagRemoved(ReaderIndex reader, TargetIndex target) {
+  logger.info("tag_state: OnTagRemoved (reader %d, target %d)", reader,
+              target);
+
+  auto &slot = tag_slots_[reader][target];
+  if (slot.tag_uid) {
+    EndTagSessions(reader, *slot.tag_uid);
+    slot.tag_uid.reset();
+  }
+  PublishTerminalState(
+      reader, target, terminal::MakeState<terminal::State>(terminal::Idle{}));
+
+  // With several tags, the allocations of concurrent taps are included.
+  auto &tap_start = slot.tap_start_stats;
+  auto stats = terminal::GetStatePool().GetStats();
+  logger.info("Tap took %lu state allocations (%lu from heap, pool peak %lu)",
+              stats.pool_allocations + stats.heap_allocations -
+                  tap_start.pool_allocations - tap_start.heap_allocations,
+              stats.heap_allocations - tap_start.heap_allocations,
+              stats.high_watermark);
 }
 
 void State::OnNewState(oww::state::terminal::StartSession state) {
   using namespace oww::state::terminal::start;
 
-  terminal_state_ = std::make_shared<terminal::State>(state);
+  UpdateMachineSession(state);
+  UpdateRecentAuth(state);
+
+  // Once a session started, continue with the next machine of the reader.
+  // This includes a local authorization whose start failed, e.g. while the
+  // cloud is unreachable. A rejected or failed start ends the tap, the next
+  // machines would most likely fail the same way and the user has to see
+  // this result.
+  std::shared_ptr<const MachineConfig> next_machine;
+  if (state.machine && terminal::IsCompleted(state) &&
+      terminal::IsAuthorized(state)) {
+    next_machine = NextMachine(state.reader, state.machine.get());
+  }
+  auto reader = state.reader;
+  auto target = state.target;
+  auto tag_uid = state.tag_uid;
+
+  PublishTerminalState(reader, target,
+                       terminal::MakeState<terminal::State>(std::move(state)));
+
+  if (next_machine) {
+    OnNewState(
+        NewStartSession(reader, target, tag_uid, std::move(next_machine)));
+  }
 }
 void State::OnNewState(oww::state::terminal::Personalize state) {
   using namespace oww::state::terminal::personalize;
 
-  terminal_state_ = std::make_shared<terminal::State>(state);
+  auto reader = state.reader;
+  auto target = state.target;
+  PublishTerminalState(reader, target,
+                       terminal::MakeState<terminal::State>(std::move(state)));
 }
 
 }  // namespace oww::state
@@ -1,9 +1,18 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
+#include "allowlist.h"
 #include "cloud_request.h"
 #include "common.h"
+#include "common/change_signal.h"
+#include "common/published.h"
+#include "common/recent_auth_cache.h"
 #include "configuration.h"
 #include "event/state_event.h"
+#include "machine_session.h"
+#include "metering.h"
 #include "terminal/state.h"
 
 namespace oww::state {
@@ -16,30 +25,182 @@ class State : public event::IStateEvent, public CloudRequest {
 
   Configuration* GetConfiguration() { return configuration_.get(); }
 
+  Allowlist* GetAllowlist() { return allowlist_.get(); }
+
+  Metering* GetMetering() { return &metering_; }
+
+  // Returns the terminal state to display, which is the one of the tag
+  // presented last. Safe to call from any thread.
   std::shared_ptr<terminal::State> GetTerminalState() {
-    return terminal_state_;
+    return terminal_state_.Get();
   }
 
- public:
-  os_mutex_t mutex_ = 0;
-  void lock() { os_mutex_lock(mutex_); };
-  bool tryLock() { return os_mutex_trylock(mutex_); };
-  void unlock() { os_mutex_unlock(mutex_); };
+  // Version of the terminal state, incremented on every transition.
+  uint32_t GetTerminalStateVersion() { return terminal_state_.Version(); }
+
+  // Incremented whenever something shown by the UI changed, i.e. the
+  // terminal state above or the configuration.
+  uint32_t GetDisplayVersion() { return display_changes_.Version(); }
+
+  // Blocks until the display version moved past last_version, or until
+  // timeout_ms passed. Returns the current version.
+  uint32_t WaitForDisplayChange(
+      uint32_t last_version,
+      system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER) {
+    return display_changes_.WaitForChange(last_version, timeout_ms);
+  }
+
+  // Wakes up the threads waiting for a display change, e.g. on touch input.
+  void WakeDisplay() { display_changes_.Notify(); }
+
+  // Returns the terminal state of a single target of a reader. Safe to call
+  // from any thread.
+  std::shared_ptr<terminal::State> GetTerminalState(ReaderIndex reader,
+                                                    TargetIndex target) {
+    return tag_slots_[reader][target].terminal_state.Get();
+  }
+
+  uint32_t GetTerminalStateVersion(ReaderIndex reader, TargetIndex target) {
+    return tag_slots_[reader][target].terminal_state.Version();
+  }
+
+  // Returns the sessions of all machines. Safe to call from any thread.
+  std::shared_ptr<const MachineSessions> GetMachineSessions() {
+    return machine_sessions_.Get();
+  }
+
+  uint32_t GetMachineSessionsVersion() { return machine_sessions_.Version(); }
+
+  // Blocks until the machine sessions changed past last_version, or until
+  // timeout_ms passed. Returns the current version.
+  uint32_t WaitForMachineSessionsChange(
+      uint32_t last_version,
+      system_tick_t timeout_ms = CONCURRENT_WAIT_FOREVER) {
+    return machine_sessions_.WaitForChange(last_version, timeout_ms);
+  }
 
  private:
   static Logger logger;
 
   std::unique_ptr<Configuration> configuration_ = nullptr;
-  std::shared_ptr<terminal::State> terminal_state_;
+  std::unique_ptr<Allowlist> allowlist_ = nullptr;
+  // Counted in Loop(), from the published machine sessions.
+  Metering metering_;
+
+  // Tag session of a single target of a reader.
+  struct TagSlot {
+    Published<terminal::State> terminal_state{
+        terminal::MakeState<terminal::State>(terminal::Idle{})};
+
+    // UID of the authenticated tag, to end its machine sessions on removal.
+    std::optional<TagUid> tag_uid;
+
+    // State pool statistics at the time the current tag was found, to log
+    // the allocations per tap.
+    terminal::StatePool::Stats tap_start_stats;
+  };
+
+  std::array<std::array<TagSlot, max_targets>, max_readers> tag_slots_;
+
+  // Terminal state of the displayed tag slot, see GetTerminalState().
+  Published<terminal::State> terminal_state_{
+      terminal::MakeState<terminal::State>(terminal::Idle{})};
+  ReaderIndex displayed_reader_ = 0;
+  TargetIndex displayed_target_ = 0;
+  std::mutex display_mutex_;
+  // See GetDisplayVersion().
+  ChangeSignal display_changes_;
+
+  // Publishes the terminal state of a tag slot, and to the display if the
+  // tag is (now) the one presented last.
+  void PublishTerminalState(ReaderIndex reader, TargetIndex target,
+                            std::shared_ptr<terminal::State> state);
+
+  Published<const MachineSessions> machine_sessions_{
+      std::make_shared<const MachineSessions>()};
+  // Serializes updates of machine_sessions_ from several readers.
+  std::mutex sessions_mutex_;
+
+  // Ended sessions whose cloud id is not known yet, reported once the cloud
+  // answered their start. Guarded by sessions_mutex_.
+  struct PendingSessionEnd {
+    std::shared_ptr<const MachineConfig> machine;
+    TagUid tag_uid;
+    std::shared_ptr<CloudResponse<oww::session::StartSessionResponseT>>
+        start_response;
+    uint32_t duration_ms;
+  };
+  std::vector<PendingSessionEnd> pending_session_ends_;
+
+  // Tokens of the sessions recently authorized by the cloud, see
+  // config::recent_auth.
+  RecentAuthCache<config::recent_auth::capacity> recent_auth_{
+      config::recent_auth::window_ms};
+  std::mutex recent_auth_mutex_;
+
+  // Remembers the token of a session authorized by the cloud, respectively
+  // forgets it once the cloud rejected it.
+  void UpdateRecentAuth(const terminal::StartSession &state);
+
+  // Returns the first machine served by the reader with an index above
+  // after, or the first machine of the reader if after is nullptr.
+  std::shared_ptr<const MachineConfig> NextMachine(
+      ReaderIndex reader, const MachineConfig *after);
+
+  // Whether the machine has a session of another tag, which is still
+  // present.
+  bool IsMachineInUse(const MachineConfig &machine, const TagUid &uid);
+
+  // Starts a session on the machine, or rejects the tag right away if the
+  // machine is in use by another tag.
+  terminal::StartSession NewStartSession(
+      ReaderIndex reader, TargetIndex target, const TagUid &uid,
+      std::shared_ptr<const MachineConfig> machine);
+
+  // Starts, confirms or ends the machine session according to the
+  // StartSession state.
+  void UpdateMachineSession(const terminal::StartSession &state);
+
+  // Ends the sessions bound to the tag removed from the reader, respectively
+  // starts their session timeout.
+  void EndTagSessions(ReaderIndex reader, const TagUid &uid);
+
+  // Queues the report of a session, which ended at ended_at. A session whose
+  // start the cloud did not answer yet is reported once it did, see
+  // ReportPendingSessionEnds(). A session the cloud never started (it was
+  // unreachable) is reported without id, so the cloud records it afterwards.
+  // Requires sessions_mutex_.
+  void ReportSessionEnd(const MachineSession &session,
+                        system_tick_t ended_at);
+
+  // Queues an endSession request, see fbs/end_session.fbs.
+  void QueueSessionEnd(const std::string &session_id,
+                       const MachineConfig &machine, const TagUid &uid,
+                       uint32_t duration_ms);
+
+  // Reports and removes the sessions whose timeout passed.
+  void EndExpiredSessions(system_tick_t now);
+
+  // Binds the running sessions to the MachineConfig of the current snapshot.
+  // A session whose machine got removed, or moved to another index, reader or
+  // relay, is reported and removed.
+  void RebindMachineSessions();
+
+  void ReportPendingSessionEnds();
 
  public:
-  virtual void OnConfigChanged() override;
+  virtual void OnConfigChanged(uint8_t changes) override;
 
-  virtual void OnTagFound() override;
-  virtual void OnBlankNtag(std::array<uint8_t, 7> uid) override;
-  virtual void OnUnknownTag() override;
-  virtual void OnTagRemoved() override;
-  virtual void OnTagAuthenicated(std::array<uint8_t, 7> uid) override;
+  // The tag events and state transitions of a reader are called from its
+  // NfcTags thread only, those of different readers run concurrently. Data
+  // shared between readers is guarded by the mutexes above.
+  virtual void OnTagFound(ReaderIndex reader, TargetIndex target) override;
+  virtual void OnBlankNtag(ReaderIndex reader, TargetIndex target,
+                           std::array<uint8_t, 7> uid) override;
+  virtual void OnUnknownTag(ReaderIndex reader, TargetIndex target) override;
+  virtual void OnTagRemoved(ReaderIndex reader, TargetIndex target) override;
+  virtual void OnTagAuthenicated(ReaderIndex reader, TargetIndex target,
+                                 std::array<uint8_t, 7> uid) override;
   virtual void OnNewState(oww::state::terminal::StartSession state) override;
   virtual void OnNewState(oww::state::terminal::Personalize state) override;
 };
@@ -13,40 +13,52 @@ namespace oww::state::terminal {
 using namespace personalize;
 using namespace config::tag;
 
-void UpdateNestedState(oww::state::State &state_manager, Personalize last_state,
-                       personalize::State updated_nested_state) {
-  state_manager.lock();
+// Transitions the nested state from `from` to `to`. Transitions not declared
+// in personalize::Transitions fail to compile.
+template <typename From, typename To>
+void UpdateNestedState(oww::state::State &state_manager,
+                       const Personalize &last_state, const From & /*from*/,
+                       To to) {
+  static_assert(Transitions::Allows<From, To>(),
+                "Illegal personalization transition");
+
   state_manager.OnNewState(Personalize{
       .tag_uid = last_state.tag_uid,
-      .state = std::make_shared<personalize::State>(updated_nested_state)});
-  state_manager.unlock();
+      .reader = last_state.reader,
+      .target = last_state.target,
+      .state = MakeState<personalize::State>(std::move(to))});
 }
 
-void UpdateFailedState(oww::state::State &state_manager, Personalize last_state,
+template <typename From>
+void UpdateFailedState(oww::state::State &state_manager,
+                       const Personalize &last_state, const From &from,
                        String failure_message) {
-  UpdateNestedState(state_manager, last_state,
-                    Failed{.message = failure_message});
+  UpdateNestedState(state_manager, last_state, from,
+                    Failed{.message = std::move(failure_message)});
 }
 
-void OnWait(Personalize state, Wait &wait, oww::state::State &state_manager) {
+void OnWait(const Personalize &state, Wait &wait,
+            oww::state::State &state_manager,
+            const CompletionCallback &resume) {
   if (millis() < wait.timeout) return;
   using namespace oww::personalization;
 
   KeyDiversificationRequestT request;
   request.token_id = std::make_unique<oww::ntag::TagUid>(
-      flatbuffers::span<uint8_t, 7>(state.tag_uid));
+      flatbuffers::span<const uint8_t, 7>(state.tag_uid));
 
   UpdateNestedState(
-      state_manager, state,
+      state_manager, state, wait,
       AwaitKeyDiversificationResponse{
           .response =
               state_manager.SendTerminalRequest<KeyDiversificationRequestT,
                                                 KeyDiversificationResponseT>(
-                  "personalization", request)});
+                  "personalization", request, CONCURRENT_WAIT_FOREVER,
+                  resume)});
 }
 
 void OnAwaitKeyDiversificationResponse(
-    Personalize state, AwaitKeyDiversificationResponse &response_holder,
+    const Personalize &state, AwaitKeyDiversificationResponse &response_holder,
     oww::state::State &state_manager) {
   auto cloud_response = response_holder.response.get();
   if (IsPending(*cloud_response)) {
@@ -82,7 +94,7 @@ tl::expected<std::array<uint8_t, 16>, Ntag424::DNA_StatusCode> ProbeKeys(
   return tl::unexpected(Ntag424::DNA_StatusCode::AUTHENTICATION_ERROR);
 };
 
-void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
+void OnDoPersonalizeTag(const Personalize &state, DoPersonalizeTag &update_tag,
                         Ntag424 &ntag_interface,
                         oww::state::State &state_manager) {
   std::array<uint8_t, 16> factory_default_key = {};
@@ -91,40 +103,45 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
       ProbeKeys(ntag_interface, key_application,
                 {factory_default_key, update_tag.application_key});
   if (!current_key_0) {
-    return UpdateFailedState(state_manager, state, "Cant authenticate key 0");
+    return UpdateFailedState(state_manager, state, update_tag,
+                             "Cant authenticate key 0");
   }
 
   auto current_key_1 =
       ProbeKeys(ntag_interface, key_terminal,
                 {factory_default_key, update_tag.terminal_key});
   if (!current_key_1) {
-    return UpdateFailedState(state_manager, state, "Cant authenticate key 1");
+    return UpdateFailedState(state_manager, state, update_tag,
+                             "Cant authenticate key 1");
   }
   auto current_key_2 = ProbeKeys(ntag_interface, key_authorization,
                                  {factory_default_key, update_tag.card_key});
   if (!current_key_2) {
-    return UpdateFailedState(state_manager, state, "Cant authenticate key 2");
+    return UpdateFailedState(state_manager, state, update_tag,
+                             "Cant authenticate key 2");
   }
 
   auto current_key_3 =
       ProbeKeys(ntag_interface, key_reserved_1,
                 {factory_default_key, update_tag.reserved_1_key});
   if (!current_key_3) {
-    return UpdateFailedState(state_manager, state, "Cant authenticate key 3");
+    return UpdateFailedState(state_manager, state, update_tag,
+                             "Cant authenticate key 3");
   }
 
   auto current_key_4 =
       ProbeKeys(ntag_interface, key_reserved_2,
                 {factory_default_key, update_tag.reserved_2_key});
   if (!current_key_4) {
-    return UpdateFailedState(state_manager, state, "Cant authenticate key 4");
+    return UpdateFailedState(state_manager, state, update_tag,
+                             "Cant authenticate key 4");
   }
 
   if (auto result =
           ntag_interface.Authenticate(key_application, current_key_0.value());
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("Authentication failed (reason: %d)", result));
   }
 
@@ -133,7 +150,7 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
           /* key_version */ 1);
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("ChangeKey(terminal) failed [%d]", result));
   }
 
@@ -142,7 +159,7 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
                                    update_tag.card_key, /* key_version */ 1);
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("ChangeKey(auth) failed [%d]", result));
   }
 
@@ -151,7 +168,7 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
           /* key_version */ 1);
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("ChangeKey(reserved1)failed [%d]", result));
   }
 
@@ -160,7 +177,7 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
           /* key_version */ 1);
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("ChangeKey(reserved2) failed [%d]", result));
   }
 
@@ -169,25 +186,44 @@ void OnDoPersonalizeTag(Personalize state, DoPersonalizeTag &update_tag,
           1);
       !result) {
     return UpdateFailedState(
-        state_manager, state,
+        state_manager, state, update_tag,
         String::format("ChangeKey(application) failed [%d]", result));
   }
 
-  UpdateNestedState(state_manager, state, Completed{});
+  UpdateNestedState(state_manager, state, update_tag, Completed{});
+}
+
+bool IsCompleted(const Personalize &personalize) {
+  return std::holds_alternative<Completed>(*personalize.state) ||
+         std::holds_alternative<Failed>(*personalize.state);
 }
 
 // ---- Loop dispatchers ------------------------------------------------------
 
-void Loop(Personalize state, oww::state::State &state_manager,
-          Ntag424 &ntag_interface) {
-  if (auto nested = std::get_if<Wait>(state.state.get())) {
-    OnWait(state, *nested, state_manager);
-  } else if (auto nested = std::get_if<AwaitKeyDiversificationResponse>(
-                 state.state.get())) {
-    OnAwaitKeyDiversificationResponse(state, *nested, state_manager);
-  } else if (auto nested = std::get_if<DoPersonalizeTag>(state.state.get())) {
-    OnDoPersonalizeTag(state, *nested, ntag_interface, state_manager);
-  }
+system_tick_t Loop(const Personalize &state,
+                   oww::state::State &state_manager, Ntag424 &ntag_interface,
+                   const CompletionCallback &resume) {
+  return Dispatch(
+      *state.state,
+      overloaded{
+          [&](Wait &nested) -> system_tick_t {
+            OnWait(state, nested, state_manager, resume);
+
+            // Resume when the timer expires.
+            auto now = millis();
+            return now < nested.timeout ? nested.timeout - now
+                                        : CONCURRENT_WAIT_FOREVER;
+          },
+          [&](AwaitKeyDiversificationResponse &nested) -> system_tick_t {
+            OnAwaitKeyDiversificationResponse(state, nested, state_manager);
+            return CONCURRENT_WAIT_FOREVER;
+          },
+          [&](DoPersonalizeTag &nested) -> system_tick_t {
+            OnDoPersonalizeTag(state, nested, ntag_interface, state_manager);
+            return CONCURRENT_WAIT_FOREVER;
+          },
+          [](auto &) -> system_tick_t { return CONCURRENT_WAIT_FOREVER; },
+      });
 }
 
 }  // namespace oww::state::terminal
\ No newline at end of file
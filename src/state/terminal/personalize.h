@@ -1,9 +1,11 @@
 #pragma once
 
 #include "../../common.h"
+#include "common/state_machine.h"
 #include "fbs/personalization_generated.h"
 #include "nfc/driver/Ntag424.h"
 #include "state/cloud_response.h"
+#include "state/reader.h"
 
 namespace oww::state {
 class State;
@@ -41,14 +43,36 @@ struct Failed {
 using State = std::variant<Wait, AwaitKeyDiversificationResponse,
                            DoPersonalizeTag, Completed, Failed>;
 
+// Legal transitions of State. Completed and Failed are final.
+using Transitions = TransitionTable<
+    Transition<Wait, AwaitKeyDiversificationResponse>,
+    Transition<AwaitKeyDiversificationResponse, DoPersonalizeTag>,
+    Transition<AwaitKeyDiversificationResponse, Failed>,
+    Transition<DoPersonalizeTag, Completed>,
+    Transition<DoPersonalizeTag, Failed>>;
+
 }  // namespace personalize
 
 struct Personalize {
   std::array<uint8_t, 7> tag_uid;
+  // Reader the tag was presented on, and its target on the reader.
+  ReaderIndex reader = 0;
+  TargetIndex target = 0;
   std::shared_ptr<personalize::State> state;
 };
 
-void Loop(Personalize start_session_state, oww::state::State &state_manager,
-          Ntag424 &ntag_interface);
+// Whether the personalization completed or failed.
+bool IsCompleted(const Personalize &personalize);
+
+// Performs the pending action of the nested state, if any.
+//
+// Awaited cloud responses call resume once completed, so the flow continues
+// right away instead of being polled. Returns the time in ms after which the
+// state needs to be looped again, or CONCURRENT_WAIT_FOREVER if it only
+// progresses on a state transition or resume.
+system_tick_t Loop(const Personalize &start_session_state,
+                   oww::state::State &state_manager,
+                   Ntag424 &ntag_interface,
+                   const CompletionCallback &resume);
 
 }  // namespace oww::state::terminal
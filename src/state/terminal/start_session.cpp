@@ -12,53 +12,68 @@ using namespace start;
 using namespace config::tag;
 using namespace oww::session;
 
-void UpdateNestedState(
-    oww::state::State &state_manager, StartSession last_state,
-    oww::state::terminal::start::State updated_nested_state) {
-  state_manager.lock();
+// Transitions the nested state from `from` to `to`. Transitions not declared
+// in start::Transitions fail to compile.
+template <typename From, typename To>
+void UpdateNestedState(oww::state::State &state_manager,
+                       const StartSession &last_state, const From & /*from*/,
+                       To to) {
+  static_assert(Transitions::Allows<From, To>(),
+                "Illegal start session transition");
+
   state_manager.OnNewState(StartSession{
       .tag_uid = last_state.tag_uid,
-      .machine_id = last_state.machine_id,
-      .state = std::make_shared<start::State>(updated_nested_state)});
-  state_manager.unlock();
+      .reader = last_state.reader,
+      .target = last_state.target,
+      .machine = last_state.machine,
+      .locally_authorized = last_state.locally_authorized,
+      .state = MakeState<start::State>(std::move(to))});
 }
 
-template <typename AuthenticationT>
-void UpdateStartSessionRequest(StartSession last_state,
+template <typename From, typename AuthenticationT>
+void UpdateStartSessionRequest(const StartSession &last_state,
+                               const From &from,
                                AuthenticationT authentication,
-                               oww::state::State &state_manager) {
+                               oww::state::State &state_manager,
+                               const CompletionCallback &resume) {
   StartSessionRequestT request;
-  request.machine_id = last_state.machine_id;
+  if (last_state.machine) {
+    request.machine_id = last_state.machine->machine_id.c_str();
+  }
   request.token_id = std::make_unique<oww::ntag::TagUid>(
-      flatbuffers::span<uint8_t, 7>(last_state.tag_uid));
+      flatbuffers::span<const uint8_t, 7>(last_state.tag_uid));
 
-  request.authentication.Set(authentication);
+  request.authentication.Set(std::move(authentication));
 
   UpdateNestedState(
-      state_manager, last_state,
+      state_manager, last_state, from,
       AwaitStartSessionResponse{
           .response = state_manager.SendTerminalRequest<StartSessionRequestT,
                                                         StartSessionResponseT>(
-              "startSession", request)});
+              "startSession", request, CONCURRENT_WAIT_FOREVER, resume)});
 }
 
-void OnStartWithRecentAuth(StartSession state, StartWithRecentAuth &start,
-                           oww::state::State &state_manager) {
+void OnStartWithRecentAuth(const StartSession &state,
+                           StartWithRecentAuth &start,
+                           oww::state::State &state_manager,
+                           const CompletionCallback &resume) {
   RecentAuthenticationT authentication;
   authentication.token = start.recent_auth_token;
 
-  UpdateStartSessionRequest(state, authentication, state_manager);
+  UpdateStartSessionRequest(state, start, std::move(authentication),
+                            state_manager, resume);
 }
 
-void OnStartWithNfcAuth(StartSession state, StartWithNfcAuth &start,
+void OnStartWithNfcAuth(const StartSession &state, StartWithNfcAuth &start,
                         Ntag424 &ntag_interface,
-                        oww::state::State &state_manager) {
+                        oww::state::State &state_manager,
+                        const CompletionCallback &resume) {
   auto auth_challenge = ntag_interface.AuthenticateWithCloud_Begin(
       config::tag::key_authorization);
 
   if (!auth_challenge) {
     return UpdateNestedState(
-        state_manager, state,
+        state_manager, state, start,
         Failed{.tag_status = auth_challenge.error(),
                .message =
                    String::format("AuthenticateEV2First_Part1 failed [dna:%d]",
@@ -69,10 +84,11 @@ void OnStartWithNfcAuth(StartSession state, StartWithNfcAuth &start,
   authentication.ntag_challenge.assign(auth_challenge->begin(),
                                        auth_challenge->end());
 
-  UpdateStartSessionRequest(state, authentication, state_manager);
+  UpdateStartSessionRequest(state, start, std::move(authentication),
+                            state_manager, resume);
 }
 
-void OnAwaitStartSessionResponse(StartSession state,
+void OnAwaitStartSessionResponse(const StartSession &state,
                                  AwaitStartSessionResponse &response_holder,
                                  oww::state::State &state_manager) {
   auto cloud_response = response_holder.response.get();
@@ -84,18 +100,18 @@ void OnAwaitStartSessionResponse(StartSession state,
       std::get_if<StartSessionResponseT>(cloud_response);
   if (!start_session_response) {
     return UpdateNestedState(
-        state_manager, state,
+        state_manager, state, response_holder,
         Failed{.error = std::get<ErrorType>(*cloud_response)});
   }
 
   switch (start_session_response->result.type) {
     case oww::session::AuthorizationResult::StateAuthorized:
       return UpdateNestedState(
-          state_manager, state,
+          state_manager, state, response_holder,
           Succeeded{.session_id = start_session_response->session_id});
     case oww::session::AuthorizationResult::StateRejected:
       return UpdateNestedState(
-          state_manager, state,
+          state_manager, state, response_holder,
           Rejected{
               .message =
                   start_session_response->result.AsStateRejected()->message});
@@ -103,24 +119,48 @@ void OnAwaitStartSessionResponse(StartSession state,
       // FIXME IMPLEMENT
     default:
       return UpdateNestedState(
-          state_manager, state,
+          state_manager, state, response_holder,
           Failed{.error = ErrorType::kMalformedResponse,
                  .message = "Unknown AuthorizationResult type"});
   }
 }
 
+bool IsAuthorized(const StartSession &session) {
+  if (std::holds_alternative<Succeeded>(*session.state)) return true;
+  if (!session.locally_authorized) return false;
+
+  // A failed request (e.g. the cloud is unreachable) keeps the local
+  // decision, only a rejection overrides it.
+  return !std::holds_alternative<Rejected>(*session.state);
+}
+
+bool IsCompleted(const StartSession &session) {
+  return std::holds_alternative<Succeeded>(*session.state) ||
+         std::holds_alternative<Rejected>(*session.state) ||
+         std::holds_alternative<Failed>(*session.state);
+}
+
 // ---- Loop dispatchers ------------------------------------------------------
 
-void Loop(StartSession state, oww::state::State &state_manager,
-          Ntag424 &ntag_interface) {
-  if (auto nested = std::get_if<StartWithRecentAuth>(state.state.get())) {
-    OnStartWithRecentAuth(state, *nested, state_manager);
-  } else if (auto nested = std::get_if<StartWithNfcAuth>(state.state.get())) {
-    OnStartWithNfcAuth(state, *nested, ntag_interface, state_manager);
-  } else if (auto nested =
-                 std::get_if<AwaitStartSessionResponse>(state.state.get())) {
-    OnAwaitStartSessionResponse(state, *nested, state_manager);
-  }
+system_tick_t Loop(const StartSession &state,
+                   oww::state::State &state_manager, Ntag424 &ntag_interface,
+                   const CompletionCallback &resume) {
+  Dispatch(*state.state,
+           overloaded{
+               [&](StartWithRecentAuth &nested) {
+                 OnStartWithRecentAuth(state, nested, state_manager, resume);
+               },
+               [&](StartWithNfcAuth &nested) {
+                 OnStartWithNfcAuth(state, nested, ntag_interface,
+                                    state_manager, resume);
+               },
+               [&](AwaitStartSessionResponse &nested) {
+                 OnAwaitStartSessionResponse(state, nested, state_manager);
+               },
+               [](auto &) {},
+           });
+
+  return CONCURRENT_WAIT_FOREVER;
 }
 
 }  // namespace oww::state::terminal
\ No newline at end of file
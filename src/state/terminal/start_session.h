@@ -1,12 +1,15 @@
 #pragma once
 
 #include "common.h"
+#include "common/state_machine.h"
 #include "fbs/session_generated.h"
 #include "nfc/driver/Ntag424.h"
 #include "state/cloud_response.h"
+#include "state/reader.h"
 
 namespace oww::state {
 class State;
+class MachineConfig;
 }  // namespace oww::state
 
 namespace oww::state::terminal {
@@ -47,15 +50,48 @@ using State =
                  AwaitStartSessionResponse, AwaitAuthenticatePart2Response,
                  Succeeded, Rejected, Failed>;
 
+// Legal transitions of State. Succeeded, Rejected and Failed are final.
+using Transitions =
+    TransitionTable<Transition<StartWithRecentAuth, AwaitStartSessionResponse>,
+                    Transition<StartWithNfcAuth, AwaitStartSessionResponse>,
+                    Transition<StartWithNfcAuth, Failed>,
+                    Transition<AwaitStartSessionResponse, Succeeded>,
+                    Transition<AwaitStartSessionResponse, Rejected>,
+                    Transition<AwaitStartSessionResponse, Failed>>;
+
 }  // namespace start
 
 struct StartSession {
   std::array<uint8_t, 7> tag_uid;
-  std::string machine_id;
+  // Reader the tag was presented on, and its target on the reader.
+  ReaderIndex reader = 0;
+  TargetIndex target = 0;
+  // Machine the session is started for, shared with the configuration it was
+  // taken from. Null if the terminal has no machine configured.
+  std::shared_ptr<const MachineConfig> machine;
+  // The tag is on the local allowlist (see oww::state::Allowlist), or had a
+  // session on the machine recently (see StartWithRecentAuth).
+  bool locally_authorized = false;
   std::shared_ptr<start::State> state;
 };
 
-void Loop(StartSession start_session_state, oww::state::State &state_manager,
-          Ntag424 &ntag_interface);
+// Whether the machine may be powered for this session: Either the cloud
+// authorized it, or the local allowlist did and the cloud did not reject it.
+// This includes a start that failed, e.g. while the cloud is unreachable.
+bool IsAuthorized(const StartSession &session);
+
+// Whether the cloud decided on the session (or failed to).
+bool IsCompleted(const StartSession &session);
+
+// Performs the pending action of the nested state, if any.
+//
+// Awaited cloud responses call resume once completed, so the flow continues
+// right away instead of being polled. Returns the time in ms after which the
+// state needs to be looped again, or CONCURRENT_WAIT_FOREVER if it only
+// progresses on a state transition or resume.
+system_tick_t Loop(const StartSession &start_session_state,
+                   oww::state::State &state_manager,
+                   Ntag424 &ntag_interface,
+                   const CompletionCallback &resume);
 
 }  // namespace oww::state::terminal
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+
 #include "common.h"
+#include "common/block_pool.h"
 #include "personalize.h"
 #include "start_session.h"
 
@@ -16,4 +19,26 @@ struct Unknown {};
 using State = std::variant<Idle, Detected, Authenticated, StartSession,
                            Personalize, Unknown>;
 
+// Every transition allocates a new terminal state, and possibly a new nested
+// state. These are served from a fixed pool instead of the heap. A block
+// holds the state together with the shared_ptr control block.
+constexpr size_t state_pool_block_size =
+    std::max({sizeof(State), sizeof(start::State),
+              sizeof(personalize::State)}) +
+    32;
+// Per tag the current and previous state, each with a nested state, plus
+// references held by the UI while rendering.
+constexpr size_t state_pool_block_count = 8 + 8 * max_readers * max_targets;
+
+using StatePool = BlockPool<state_pool_block_size, state_pool_block_count>;
+
+StatePool &GetStatePool();
+
+// Like std::make_shared, but allocating from the StatePool.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeState(Args &&...args) {
+  return std::allocate_shared<T>(PoolAllocator<T, StatePool>(GetStatePool()),
+                                 std::forward<Args>(args)...);
+}
+
 }  // namespace oww::state::terminal
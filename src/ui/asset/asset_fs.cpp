@@ -0,0 +1,101 @@
+#include "asset_fs.h"
+
+#include <lvgl.h>
+
+Logger AssetFs::logger("asset_fs");
+
+namespace {
+
+struct AssetFile {
+  ApplicationAsset asset;
+  uint32_t position;
+};
+
+// Assets of the running firmware, they only change with an OTA update.
+spark::Vector<ApplicationAsset> assets;
+
+void* Open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
+  if (mode != LV_FS_MODE_RD) return nullptr;
+  if (*path == '/') path++;
+
+  for (auto& asset : assets) {
+    if (asset.name() == path && asset.isValid()) {
+      auto file = new AssetFile{.asset = asset, .position = 0};
+      file->asset.reset();
+      return file;
+    }
+  }
+  return nullptr;
+}
+
+lv_fs_res_t Close(lv_fs_drv_t* drv, void* file_p) {
+  delete static_cast<AssetFile*>(file_p);
+  return LV_FS_RES_OK;
+}
+
+lv_fs_res_t Read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr,
+                 uint32_t* br) {
+  auto file = static_cast<AssetFile*>(file_p);
+  int result = file->asset.read(static_cast<char*>(buf), btr);
+  if (result < 0) {
+    *br = 0;
+    return LV_FS_RES_HW_ERR;
+  }
+  *br = result;
+  file->position += result;
+  return LV_FS_RES_OK;
+}
+
+lv_fs_res_t Seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos,
+                 lv_fs_whence_t whence) {
+  auto file = static_cast<AssetFile*>(file_p);
+  uint32_t size = file->asset.size();
+  switch (whence) {
+    case LV_FS_SEEK_CUR:
+      pos += file->position;
+      break;
+    case LV_FS_SEEK_END:
+      pos += size;
+      break;
+    default:
+      break;
+  }
+  if (pos > size) return LV_FS_RES_INV_PARAM;
+
+  // Assets are streams, seeking backwards starts over.
+  if (pos < file->position) {
+    file->asset.reset();
+    file->position = 0;
+  }
+  if (pos > file->position) {
+    file->asset.skip(pos - file->position);
+    file->position = pos;
+  }
+  return LV_FS_RES_OK;
+}
+
+lv_fs_res_t Tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
+  *pos_p = static_cast<AssetFile*>(file_p)->position;
+  return LV_FS_RES_OK;
+}
+
+}  // namespace
+
+Status AssetFs::Begin() {
+  assets = System.assetsAvailable();
+  for (auto& asset : assets) {
+    logger.info("Asset %s, %u bytes", asset.name().c_str(), asset.size());
+  }
+
+  static lv_fs_drv_t drv;
+  lv_fs_drv_init(&drv);
+  drv.letter = letter;
+  drv.open_cb = Open;
+  drv.close_cb = Close;
+  drv.read_cb = Read;
+  drv.seek_cb = Seek;
+  drv.tell_cb = Tell;
+  lv_fs_drv_register(&drv);
+
+  return Status::kOk;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "common.h"
+
+// Read-only LVGL file system on the Particle OTA assets, see assetOtaDir in
+// project.properties. Assets are opened as "A:<name>", e.g.
+// "A:oww_logo.rle", and streamed from flash on read.
+class AssetFs {
+ public:
+  static constexpr char letter = 'A';
+
+  // Registers the drive with LVGL, to be called after lv_init().
+  static Status Begin();
+
+ private:
+  static Logger logger;
+};
@@ -0,0 +1,195 @@
+#include "rle_image_decoder.h"
+
+#include <draw/lv_image_decoder_private.h>
+#include <lvgl.h>
+
+namespace {
+
+Logger logger("rle_image");
+
+constexpr uint8_t magic[4] = {'R', 'L', 'E', 'I'};
+constexpr uint8_t version = 1;
+constexpr uint8_t run_flag = 0x80;
+
+struct Header {
+  uint8_t magic[4];
+  uint8_t version;
+  uint8_t color_format;
+  uint16_t width;
+  uint16_t height;
+  uint16_t reserved;
+  // Size of the packets following the header.
+  uint32_t size;
+};
+static_assert(sizeof(Header) == 16);
+
+// Buffered reads from an LVGL file.
+class Reader {
+ public:
+  explicit Reader(lv_fs_file_t* file) : file_(file) {}
+
+  bool Read(void* data, size_t size) {
+    auto out = static_cast<uint8_t*>(data);
+    while (size > 0) {
+      if (position_ == size_ && !Fill()) return false;
+      auto chunk = std::min(size, size_t(size_ - position_));
+      memcpy(out, buffer_ + position_, chunk);
+      position_ += chunk;
+      out += chunk;
+      size -= chunk;
+    }
+    return true;
+  }
+
+ private:
+  lv_fs_file_t* file_;
+  uint8_t buffer_[256];
+  uint32_t size_ = 0;
+  uint32_t position_ = 0;
+
+  bool Fill() {
+    position_ = 0;
+    return lv_fs_read(file_, buffer_, sizeof(buffer_), &size_) ==
+               LV_FS_RES_OK &&
+           size_ > 0;
+  }
+};
+
+bool IsRleFile(lv_image_decoder_dsc_t* dsc) {
+  return dsc->src_type == LV_IMAGE_SRC_FILE &&
+         lv_strcmp(lv_fs_get_ext(static_cast<const char*>(dsc->src)),
+                   "rle") == 0;
+}
+
+bool ReadHeader(Reader& reader, Header& header) {
+  return reader.Read(&header, sizeof(header)) &&
+         memcmp(header.magic, magic, sizeof(magic)) == 0 &&
+         header.version == version &&
+         header.color_format == LV_COLOR_FORMAT_RGB565 && header.width > 0 &&
+         header.height > 0;
+}
+
+bool Decode(Reader& reader, const Header& header, lv_draw_buf_t* decoded) {
+  auto stride = decoded->header.stride;
+  auto data = decoded->data;
+  uint32_t x = 0;
+  uint32_t y = 0;
+
+  auto put = [&](uint16_t pixel) {
+    memcpy(data + y * stride + x * sizeof(pixel), &pixel, sizeof(pixel));
+    if (++x == header.width) {
+      x = 0;
+      y++;
+    }
+  };
+
+  while (y < header.height) {
+    uint8_t control;
+    if (!reader.Read(&control, sizeof(control))) return false;
+
+    uint32_t count = (control & ~run_flag) + 1;
+    if (x + count > header.width * (header.height - y)) return false;
+
+    uint16_t pixel;
+    if (control & run_flag) {
+      if (!reader.Read(&pixel, sizeof(pixel))) return false;
+      while (count--) put(pixel);
+    } else {
+      while (count--) {
+        if (!reader.Read(&pixel, sizeof(pixel))) return false;
+        put(pixel);
+      }
+    }
+  }
+  return true;
+}
+
+lv_result_t Info(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc,
+                 lv_image_header_t* header) {
+  if (!IsRleFile(dsc)) return LV_RESULT_INVALID;
+
+  lv_fs_file_t file;
+  if (lv_fs_open(&file, static_cast<const char*>(dsc->src), LV_FS_MODE_RD) !=
+      LV_FS_RES_OK) {
+    return LV_RESULT_INVALID;
+  }
+  Reader reader(&file);
+  Header rle_header;
+  bool header_ok = ReadHeader(reader, rle_header);
+  lv_fs_close(&file);
+  if (!header_ok) return LV_RESULT_INVALID;
+
+  header->magic = LV_IMAGE_HEADER_MAGIC;
+  header->cf = LV_COLOR_FORMAT_RGB565;
+  header->flags = 0;
+  header->w = rle_header.width;
+  header->h = rle_header.height;
+  header->stride = rle_header.width * sizeof(uint16_t);
+  return LV_RESULT_OK;
+}
+
+lv_result_t Open(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc) {
+  lv_fs_file_t file;
+  if (lv_fs_open(&file, static_cast<const char*>(dsc->src), LV_FS_MODE_RD) !=
+      LV_FS_RES_OK) {
+    return LV_RESULT_INVALID;
+  }
+
+  Reader reader(&file);
+  Header header;
+  lv_draw_buf_t* decoded = nullptr;
+  if (ReadHeader(reader, header)) {
+    decoded = lv_draw_buf_create(header.width, header.height,
+                                 LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+  }
+  if (decoded && !Decode(reader, header, decoded)) {
+    logger.error("%s is corrupt", static_cast<const char*>(dsc->src));
+    lv_draw_buf_destroy(decoded);
+    decoded = nullptr;
+  }
+  lv_fs_close(&file);
+  if (!decoded) return LV_RESULT_INVALID;
+
+  dsc->decoded = decoded;
+  if (dsc->args.no_cache || !lv_image_cache_is_enabled()) {
+    return LV_RESULT_OK;
+  }
+
+  lv_image_cache_data_t search_key;
+  search_key.src_type = dsc->src_type;
+  search_key.src = dsc->src;
+  search_key.slot.size = decoded->data_size;
+  auto entry =
+      lv_image_decoder_add_to_cache(decoder, &search_key, decoded, nullptr);
+  if (!entry) {
+    lv_draw_buf_destroy(decoded);
+    dsc->decoded = nullptr;
+    return LV_RESULT_INVALID;
+  }
+  dsc->cache_entry = entry;
+  return LV_RESULT_OK;
+}
+
+void Close(lv_image_decoder_t* decoder, lv_image_decoder_dsc_t* dsc) {
+  // Cached images are freed by the cache on eviction.
+  if (dsc->args.no_cache || !lv_image_cache_is_enabled()) {
+    lv_draw_buf_destroy(const_cast<lv_draw_buf_t*>(dsc->decoded));
+  }
+}
+
+}  // namespace
+
+Status RleImageDecoder::Begin() {
+  auto decoder = lv_image_decoder_create();
+  if (!decoder) {
+    logger.error("Unable to create the image decoder");
+    return Status::kError;
+  }
+  lv_image_decoder_set_info_cb(decoder, Info);
+  lv_image_decoder_set_open_cb(decoder, Open);
+  lv_image_decoder_set_close_cb(decoder, Close);
+
+  // Decoded images stay in RAM, bound them to a fixed budget.
+  lv_image_cache_resize(config::ui::image_cache_size, true);
+  return Status::kOk;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "common.h"
+
+// LVGL image decoder for the RLE compressed RGB565 images created by
+// tools/rle_image.py, e.g. "A:oww_logo.rle".
+//
+// An image is decoded once into a draw buffer, which is kept in LVGL's image
+// cache until it gets evicted or dropped. The file is streamed in small
+// chunks, so decoding only needs the RAM of the decoded image.
+class RleImageDecoder {
+ public:
+  // Registers the decoder with LVGL, to be called after lv_init().
+  static Status Begin();
+};
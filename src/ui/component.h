@@ -2,24 +2,25 @@
 
 #include <lvgl.h>
 
-#include "state/state.h"
+#include "state_binding.h"
 
 namespace oww::ui {
 
+// Widget tree bound to the state. Components observe the subjects of the
+// StateBinding they are created with, and update their widgets on changes
+// only.
 class Component {
  public:
-  Component(std::shared_ptr<oww::state::State> state) : state_(state) {};
+  Component(StateBinding& binding) : binding_(binding) {};
   virtual ~Component() {};
 
-  virtual void Render() = 0;
-
   operator lv_obj_t*();
 
   lv_obj_t* Root();
 
  protected:
   lv_obj_t* root_;
-  std::shared_ptr<oww::state::State> state_;
+  StateBinding& binding_;
 };
 
 }  // namespace oww::ui
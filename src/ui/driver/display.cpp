@@ -2,11 +2,20 @@
 
 #include <drivers/display/lcd/lv_lcd_generic_mipi.h>
 
+#include <algorithm>
+#include <array>
+
 #include "config.h"
 #include "state/configuration.h"
 
 // clang-format on
 
+// The panel expects RGB565 in big endian, which LVGL renders natively as
+// LV_COLOR_FORMAT_RGB565_SWAPPED.
+static_assert(LVGL_VERSION_MAJOR > 9 ||
+                  (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 3),
+              "Rendering RGB565_SWAPPED directly needs LVGL 9.3");
+
 using namespace config::ui::display;
 
 Logger display_log("display");
@@ -23,12 +32,19 @@ Display &Display::instance() {
 Display::Display()
     : spi_interface_(SPI1),
       spi_settings_(50 * MHZ, MSBFIRST, SPI_MODE0),
-      touchscreen_interface_(SPI1, resolution_horizontal, resolution_vertical,
-                             pin_touch_chipselect, pin_touch_irq) {}
+      touch_spi_settings_(2 * MHZ, MSBFIRST, SPI_MODE0),
+      touch_wake_timer_(
+          1,
+          [this]() {
+            if (wake_) wake_();
+          },
+          true) {}
 
 Display::~Display() {}
 
-Status Display::Begin() {
+Status Display::Begin(std::function<void()> wake) {
+  wake_ = wake;
+
   pinMode(pin_reset, OUTPUT);
   pinMode(pin_chipselect, OUTPUT);
   pinMode(pin_datacommand, OUTPUT);
@@ -37,13 +53,13 @@ Status Display::Begin() {
   spi_interface_.begin();
 
   digitalWrite(pin_backlight, HIGH);
-  digitalWrite(pin_reset, HIGH);
 
-  delay(200);
+  // MIPI DBI panels latch a reset pulse of 10 us, and accept the sleep out
+  // command 120 ms after the reset was released.
   digitalWrite(pin_reset, LOW);
-  delay(200);
+  delay(1);
   digitalWrite(pin_reset, HIGH);
-  delay(200);
+  delay(120);
 
   lv_init();
 #if LV_USE_LOG
@@ -63,11 +79,20 @@ Status Display::Begin() {
 
   lv_lcd_generic_mipi_set_invert(display_, true);
 
-  // FIXME: Photon2 has 3MB of RAM, so easily use 2 full size buffers
-  // (~160k each), but for this, need to fix the render issues with
-  // LV_DISPLAY_RENDER_MODE_DIRECT
+  lv_display_set_color_format(display_, LV_COLOR_FORMAT_RGB565_SWAPPED);
+
+  // The generic MIPI driver sends the rendered pixels as one block, which
+  // only holds in partial mode. In direct mode, the areas are windows of a
+  // full frame.
+  lv_display_set_flush_cb(
+      display_, [](lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+        Display::instance().Flush(area, px_map);
+      });
+
+  // Two full frames (~150k each). LVGL only renders the invalidated areas,
+  // and keeps the other frame in sync by copying them over.
   uint32_t buf_size =
-      resolution_horizontal * resolution_vertical / 10 *
+      resolution_horizontal * resolution_vertical *
       lv_color_format_get_size(lv_display_get_color_format(display_));
 
   lv_color_t *buffer_1 = (lv_color_t *)malloc(buf_size);
@@ -84,28 +109,144 @@ Status Display::Begin() {
   }
 
   lv_display_set_buffers(display_, buffer_1, buffer_2, buf_size,
-                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+                         LV_DISPLAY_RENDER_MODE_DIRECT);
 
-  touchscreen_interface_.begin();
+  pinMode(pin_touch_chipselect, OUTPUT);
+  pinSetFast(pin_touch_chipselect);
+  pinMode(pin_touch_irq, INPUT_PULLUP);
+  // Powers the controller down with its pen-down interrupt enabled.
+  ReadTouchChannel(0xd0);
+  attachInterrupt(pin_touch_irq, &OnTouchInterrupt, FALLING);
 
-  lv_indev_t *indev = lv_indev_create();
+  touch_input_ = lv_indev_create();
   lv_indev_set_type(
-      indev, LV_INDEV_TYPE_POINTER); /* Touch pad is a pointer-like device. */
-  lv_indev_set_read_cb(indev, [](auto indev, auto data) {
+      touch_input_,
+      LV_INDEV_TYPE_POINTER); /* Touch pad is a pointer-like device. */
+  lv_indev_set_read_cb(touch_input_, [](auto indev, auto data) {
     Display::instance().ReadTouchInput(indev, data);
   });
 
   return Status::kOk;
 }
 
-os_thread_return_t Display::RenderLoop() {
+uint32_t Display::RenderLoop() {
+  // The touch input is only read while the panel is touched, so LVGL doesn't
+  // wake up the thread for it otherwise.
+  auto read_timer = lv_indev_get_read_timer(touch_input_);
+  if (pen_down_ && !touch_reading_) {
+    touch_reading_ = true;
+    lv_timer_resume(read_timer);
+    lv_timer_ready(read_timer);
+  } else if (!pen_down_ && !touch_pressed_ && touch_reading_) {
+    touch_reading_ = false;
+    lv_timer_pause(read_timer);
+  }
+
+  auto render_start = micros();
   uint32_t time_till_next = lv_timer_handler();
-  delay(time_till_next);
-  display_log.info("Frame complete");
+  auto render_end = micros();
+
+  // The last chunk of the frame may still be on the wire, which keeps the
+  // bus until it is sent.
+  EndTransfer();
+
+  uint32_t render_us = render_end - render_start;
+  frame_stats_.frames++;
+  frame_stats_.render_us += render_us;
+  frame_stats_.render_max_us = std::max(frame_stats_.render_max_us, render_us);
+  frame_stats_.flush_wait_us += micros() - render_end;
+  frame_stats_.flushed_bytes += flushed_bytes_;
+  frame_stats_.flushed_max_bytes =
+      std::max(frame_stats_.flushed_max_bytes, flushed_bytes_);
+  flushed_bytes_ = 0;
+
+  if (millis() - frame_stats_start_ >= stats_interval_ms) {
+    LogFrameStats();
+  }
+
+  return time_till_next;
+}
+
+void Display::LogFrameStats() {
+  if (frame_stats_.frames > 0) {
+    display_log.info(
+        "%lu frames (%s flush): render avg %lu us, max %lu us, flush wait avg "
+        "%lu us, flushed avg %lu bytes, max %lu bytes",
+        frame_stats_.frames, async_flush ? "async" : "blocking",
+        static_cast<uint32_t>(frame_stats_.render_us / frame_stats_.frames),
+        frame_stats_.render_max_us,
+        static_cast<uint32_t>(frame_stats_.flush_wait_us /
+                              frame_stats_.frames),
+        static_cast<uint32_t>(frame_stats_.flushed_bytes /
+                              frame_stats_.frames),
+        frame_stats_.flushed_max_bytes);
+  }
+
+  frame_stats_ = {};
+  frame_stats_start_ = millis();
+}
+
+void Display::OnTransferComplete() {
+  pinSetFast(pin_chipselect);
+  instance_->transfer_active_ = false;
+  if (instance_->flush_ready_on_complete_) {
+    lv_display_flush_ready(instance_->display_);
+  }
+}
+
+void Display::Flush(const lv_area_t *area, uint8_t *px_map) {
+  auto x1 = area->x1;
+  auto x2 = area->x2;
+  auto y1 = area->y1;
+  auto y2 = area->y2;
+
+  const uint8_t caset[] = {uint8_t(x1 >> 8), uint8_t(x1), uint8_t(x2 >> 8),
+                           uint8_t(x2)};
+  const uint8_t raset[] = {uint8_t(y1 >> 8), uint8_t(y1), uint8_t(y2 >> 8),
+                           uint8_t(y2)};
+  const uint8_t cmd_caset = LV_LCD_CMD_SET_COLUMN_ADDRESS;
+  const uint8_t cmd_raset = LV_LCD_CMD_SET_PAGE_ADDRESS;
+  const uint8_t cmd_write = LV_LCD_CMD_WRITE_MEMORY_START;
+  const uint8_t cmd_write_continue = LV_LCD_CMD_WRITE_MEMORY_CONTINUE;
+  SendCommand(&cmd_caset, 1, caset, sizeof(caset));
+  SendCommand(&cmd_raset, 1, raset, sizeof(raset));
+
+  constexpr size_t pixel_size = 2;
+  constexpr size_t stride = resolution_horizontal * pixel_size;
+  size_t row_size = lv_area_get_width(area) * pixel_size;
+  size_t rows = lv_area_get_height(area);
+  const uint8_t *first_row = px_map + y1 * stride + x1 * pixel_size;
+  flushed_bytes_ += row_size * rows;
+
+  // Full width areas are contiguous in the frame buffer.
+  if (row_size == stride) {
+    SendColor(&cmd_write, 1, first_row, row_size * rows);
+    return;
+  }
+
+  // Otherwise each row is sent straight from the frame buffer. The panel
+  // wraps to the next row of the window by itself, so the rows after the
+  // first continue the memory write.
+  for (size_t row = 0; row < rows; row++) {
+    SendColor(row == 0 ? &cmd_write : &cmd_write_continue, 1,
+              first_row + row * stride, row_size, row + 1 == rows);
+  }
+}
+
+void Display::EndTransfer() {
+  while (transfer_active_) {
+    os_thread_yield();
+  }
+
+  if (transaction_open_) {
+    spi_interface_.endTransaction();
+    transaction_open_ = false;
+  }
 }
 
 void Display::SendCommand(const uint8_t *cmd, size_t cmd_size,
                           const uint8_t *param, size_t param_size) {
+  EndTransfer();
   spi_interface_.beginTransaction(spi_settings_);
 
   pinResetFast(pin_chipselect);
@@ -125,7 +266,9 @@ void Display::SendCommand(const uint8_t *cmd, size_t cmd_size,
 }
 
 void Display::SendColor(const uint8_t *cmd, size_t cmd_size,
-                        const uint8_t *param, size_t param_size) {
+                        const uint8_t *param, size_t param_size,
+                        bool is_last) {
+  EndTransfer();
   spi_interface_.beginTransaction(spi_settings_);
   pinResetFast(pin_chipselect);
   pinResetFast(pin_datacommand);
@@ -134,33 +277,96 @@ void Display::SendColor(const uint8_t *cmd, size_t cmd_size,
     spi_interface_.transfer(cmd[i]);
   }
 
-  // FIXME - this should be done in the flush callback, rather than
-  lv_draw_sw_rgb565_swap((void *)param, param_size / 2);
-
   pinSetFast(pin_datacommand);
+  if (async_flush && param_size > 0) {
+    // LVGL renders into the other buffer while the DMA sends this one, and
+    // is told the buffer is free again from OnTransferComplete().
+    transaction_open_ = true;
+    transfer_active_ = true;
+    flush_ready_on_complete_ = is_last;
+    spi_interface_.transfer(param, nullptr, param_size, &OnTransferComplete);
+    return;
+  }
+
   if (param_size > 0) {
     spi_interface_.transfer(param, nullptr, param_size, nullptr);
   }
-
-  // for (size_t i = 0; i < param_size; i++) {
-  //   spi_interface_.transfer(param[i]);
-  // }
   pinSetFast(pin_chipselect);
 
-  Display::instance_->spi_interface_.endTransaction();
-  lv_display_flush_ready(Display::instance_->display_);
+  spi_interface_.endTransaction();
+  if (is_last) lv_display_flush_ready(display_);
+}
+
+void Display::OnTouchInterrupt() {
+  instance_->pen_down_ = true;
+  instance_->touch_wake_timer_.startFromISR();
 }
 
 void Display::ReadTouchInput(lv_indev_t *indev, lv_indev_data_t *data) {
-  // if (touchscreen_interface_.touched()) {
-  //   TS_Point p = touchscreen_interface_.getPoint();
-  //   auto x = map(p.x, 220, 3850, 1, 480);  //
-  //   auto y = map(p.y, 310, 3773, 1, 320);  // Feel pretty good about this
-  //   data->point.x = x;
-  //   data->point.y = y;
-  //   data->state = LV_INDEV_STATE_PR;
-
-  // } else {
-  data->state = LV_INDEV_STATE_REL;
-  // }
+  // Sampling waits for the bus, so it is skipped while a flush is on the
+  // wire. LVGL reads again on its next period.
+  if (pen_down_ && !transfer_active_) {
+    touch_pressed_ = SampleTouch(touch_point_);
+    // The controller pulls the interrupt line low while touched.
+    if (!touch_pressed_ && pinReadFast(pin_touch_irq)) {
+      pen_down_ = false;
+    }
+  }
+
+  data->point = touch_point_;
+  data->state = touch_pressed_ ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+}
+
+bool Display::SampleTouch(lv_point_t &point) {
+  // Ends the transaction of the last flush, which is sent already.
+  EndTransfer();
+
+  // Pressure, as in the XPT2046 datasheet, with the ADC kept powered up
+  // between the conversions.
+  uint16_t z1 = ReadTouchChannel(0xb1);
+  uint16_t z2 = ReadTouchChannel(0xc1);
+  int32_t pressure = z1 + 4095 - z2;
+
+  std::array<uint16_t, touch_samples> x;
+  std::array<uint16_t, touch_samples> y;
+  for (size_t i = 0; i < touch_samples; i++) {
+    x[i] = ReadTouchChannel(0xd1);
+    y[i] = ReadTouchChannel(0x91);
+  }
+  // Powers down, which enables the pen-down interrupt again.
+  ReadTouchChannel(0xd0);
+
+  if (pressure < touch_pressure_threshold) return false;
+
+  // The median drops the outliers of a noisy panel, unlike an average.
+  auto median = [](auto &samples) {
+    auto middle = samples.begin() + samples.size() / 2;
+    std::nth_element(samples.begin(), middle, samples.end());
+    return static_cast<int32_t>(*middle);
+  };
+  auto &calibration = touch_calibration;
+  point.x = std::clamp<int32_t>(
+      lv_map(median(x), calibration.x_min, calibration.x_max, 0,
+             resolution_horizontal - 1),
+      0, resolution_horizontal - 1);
+  point.y = std::clamp<int32_t>(
+      lv_map(median(y), calibration.y_min, calibration.y_max, 0,
+             resolution_vertical - 1),
+      0, resolution_vertical - 1);
+  return true;
+}
+
+uint16_t Display::ReadTouchChannel(uint8_t command) {
+  spi_interface_.beginTransaction(touch_spi_settings_);
+  pinResetFast(pin_touch_chipselect);
+
+  spi_interface_.transfer(command);
+  uint16_t high = spi_interface_.transfer(0);
+  uint16_t low = spi_interface_.transfer(0);
+
+  pinSetFast(pin_touch_chipselect);
+  spi_interface_.endTransaction();
+
+  // 12 bit conversion result, MSB first after a busy bit.
+  return ((high << 8) | low) >> 3;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <XPT2046_Touch.h>
+#include <atomic>
+#include <functional>
 #include <lvgl.h>
 
 #include "common.h"
@@ -10,9 +11,13 @@ class Display {
  public:
   static Display &instance();
 
-  Status Begin();
+  // wake is called, from the timer thread, to get RenderLoop() called soon
+  // after the panel got touched.
+  Status Begin(std::function<void()> wake);
 
-  void RenderLoop();
+  // Runs LVGL timers and rendering, returns the time in ms until it needs to
+  // be called again.
+  uint32_t RenderLoop();
 
  private:
   // Display is a singleton - use Display.instance()
@@ -24,16 +29,73 @@ class Display {
   Display &operator=(const Display &) = delete;
 
   lv_display_t *display_ = nullptr;
-  lv_indev_t *touch_input = nullptr;
 
   SPIClass &spi_interface_;
   SPISettings spi_settings_;
-  XPT2046_Touchscreen touchscreen_interface_;
+  // The XPT2046 touch controller shares the bus, at a lower clock.
+  SPISettings touch_spi_settings_;
+
+  // A DMA transfer of pixels is on the wire. The SPI transaction stays open
+  // until EndTransfer(), as it can't be ended from the DMA interrupt.
+  std::atomic<bool> transfer_active_ = false;
+  bool transaction_open_ = false;
+  // Whether the transfer in progress is the last one of a flushed area.
+  bool flush_ready_on_complete_ = true;
+
+  // Pixel bytes sent for the current frame.
+  uint32_t flushed_bytes_ = 0;
+
+  // Sends an area of the full frame buffer px_map to the panel.
+  void Flush(const lv_area_t *area, uint8_t *px_map);
 
   void SendCommand(const uint8_t *cmd, size_t cmd_size,
                          const uint8_t *param, size_t param_size);
+  // Tells LVGL the area is flushed once the pixels are sent, unless further
+  // chunks of it follow.
   void SendColor(const uint8_t *cmd, size_t cmd_size, const uint8_t *param,
-                      size_t param_size);
+                      size_t param_size, bool is_last = true);
+
+  // Called from the DMA interrupt once the pixels are sent.
+  static void OnTransferComplete();
+
+  // Waits for the DMA transfer in progress, if any, and ends its SPI
+  // transaction.
+  void EndTransfer();
+
+  // Time spent rendering (including the flushes LVGL waited for), waiting
+  // for the last flush of a frame, and the pixel bytes sent.
+  struct FrameStats {
+    uint32_t frames = 0;
+    uint64_t render_us = 0;
+    uint32_t render_max_us = 0;
+    uint64_t flush_wait_us = 0;
+    uint64_t flushed_bytes = 0;
+    uint32_t flushed_max_bytes = 0;
+  };
+  FrameStats frame_stats_;
+  system_tick_t frame_stats_start_ = 0;
+
+  void LogFrameStats();
+
+  // The touch controller is only sampled while its pen-down interrupt
+  // fired. The interrupt handler can't wake the UI thread itself, it
+  // starts touch_wake_timer_ which calls wake_.
+  std::atomic<bool> pen_down_ = false;
+  Timer touch_wake_timer_;
+  std::function<void()> wake_;
+  lv_indev_t *touch_input_ = nullptr;
+  // Whether LVGL's read timer of touch_input_ runs.
+  bool touch_reading_ = true;
+  // Last sampled point, reported while the bus is busy with a flush.
+  lv_point_t touch_point_ = {};
+  bool touch_pressed_ = false;
+
+  static void OnTouchInterrupt();
 
   void ReadTouchInput(lv_indev_t *indev, lv_indev_data_t *data);
+
+  // Samples the touch controller, returns whether the panel is pressed and
+  // the calibrated point if so.
+  bool SampleTouch(lv_point_t &point);
+  uint16_t ReadTouchChannel(uint8_t command);
 };
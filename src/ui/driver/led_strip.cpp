@@ -0,0 +1,37 @@
+#include "led_strip.h"
+
+LedStrip *LedStrip::instance_;
+
+LedStrip::LedStrip(SPIClass &spi, size_t pixel_count)
+    : spi_(spi), pixel_count_(std::min(pixel_count, max_pixels)) {}
+
+Status LedStrip::Begin() {
+  instance_ = this;
+
+  // The LEDs are the only device on the bus, so it is set up once rather
+  // than per transaction.
+  spi_.begin();
+  spi_.setBitOrder(MSBFIRST);
+  spi_.setDataMode(SPI_MODE0);
+  spi_.setClockSpeed(ws2812b::spi_clock);
+
+  return Status::kOk;
+}
+
+void LedStrip::Show(const Color *pixels) {
+  while (transfer_active_) {
+    os_thread_yield();
+  }
+
+  // The reset bytes at the start of buffer_ stay 0.
+  auto out = buffer_.data() + ws2812b::reset_size;
+  for (size_t i = 0; i < pixel_count_; i++) {
+    out = ws2812b::Encode(pixels[i], out);
+  }
+
+  transfer_active_ = true;
+  spi_.transfer(buffer_.data(), nullptr, out - buffer_.data(),
+                &OnTransferComplete);
+}
+
+void LedStrip::OnTransferComplete() { instance_->transfer_active_ = false; }
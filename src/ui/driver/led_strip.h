@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "common.h"
+#include "ui/led_animation.h"
+#include "ws2812b.h"
+
+// WS2812B strip on the MOSI line of an SPI bus.
+//
+// Each data bit is encoded as one SPI byte, see ws2812b.h for the timing. A
+// frame, preceded by the reset time, is encoded into one buffer and sent as
+// a single DMA transfer, so Show() returns right away.
+class LedStrip {
+ public:
+  using Color = oww::ui::LedColor;
+
+  static constexpr size_t max_pixels = 32;
+
+  LedStrip(SPIClass &spi, size_t pixel_count);
+
+  Status Begin();
+
+  // Starts sending the pixels, waits for the previous frame if it is still
+  // on the wire.
+  void Show(const Color *pixels);
+
+ private:
+  SPIClass &spi_;
+  const size_t pixel_count_;
+
+  std::array<uint8_t,
+             ws2812b::reset_size + max_pixels * ws2812b::pixel_size>
+      buffer_ = {};
+  std::atomic<bool> transfer_active_ = false;
+
+  static LedStrip *instance_;
+  // Called from the DMA interrupt once the frame is sent.
+  static void OnTransferComplete();
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include "ui/led_animation.h"
+
+// Encoding of WS2812B pixels for the MOSI line of an SPI bus, see LedStrip.
+//
+// Each data bit is sent as one SPI byte of 160 ns bits, 11000000 for a 0 and
+// 11111000 for a 1. Pixels are sent in GRB order, MSB first.
+namespace ws2812b {
+
+constexpr uint32_t spi_clock = 6250 * 1000;
+constexpr uint32_t spi_bit_ns = 1000 * 1000 * 1000 / spi_clock;
+
+constexpr uint8_t code_0 = 0b11000000;
+constexpr uint8_t code_1 = 0b11111000;
+
+// SPI bytes of a pixel, 3 colors of 8 data bits.
+constexpr size_t pixel_size = 3 * 8;
+// SPI bytes of the line held low before a frame, >= 280 us.
+constexpr size_t reset_size = (280 * 1000) / (8 * spi_bit_ns) + 1;
+
+// Time the line is high for a code, the rest of the byte it is low.
+constexpr uint32_t HighNs(uint8_t code) {
+  uint32_t bits = 0;
+  while (bits < 8 && (code & (0x80 >> bits))) bits++;
+  return bits * spi_bit_ns;
+}
+
+constexpr uint32_t LowNs(uint8_t code) {
+  return 8 * spi_bit_ns - HighNs(code);
+}
+
+// Datasheet limits, with a margin for the tolerance of the SPI clock.
+constexpr uint32_t margin_ns = 25;
+constexpr bool IsWithin(uint32_t ns, uint32_t min_ns, uint32_t max_ns) {
+  return ns >= min_ns + margin_ns && ns + margin_ns <= max_ns;
+}
+static_assert(IsWithin(HighNs(code_0), 250, 550), "T0H");
+static_assert(IsWithin(LowNs(code_0), 700, 1000), "T0L");
+static_assert(IsWithin(HighNs(code_1), 650, 950), "T1H");
+static_assert(IsWithin(LowNs(code_1), 300, 600), "T1L");
+
+// Writes the pixel_size bytes of a pixel to out, returns the end.
+inline uint8_t *Encode(const oww::ui::LedColor &color, uint8_t *out) {
+  for (uint8_t value : {color.g, color.r, color.b}) {
+    for (uint8_t bit = 0x80; bit != 0; bit >>= 1) {
+      *out++ = (value & bit) ? code_1 : code_0;
+    }
+  }
+  return out;
+}
+
+}  // namespace ws2812b
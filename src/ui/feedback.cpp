@@ -0,0 +1,100 @@
+#include "feedback.h"
+
+#include <variant>
+
+namespace oww::ui {
+
+using namespace oww::state::terminal;
+
+Feedback::Feedback(StateBinding &binding, FeedbackSink &sink) : sink_(sink) {
+  observer_ = lv_subject_add_observer(
+      binding.TerminalState(),
+      [](lv_observer_t *observer, lv_subject_t *subject) {
+        auto feedback =
+            static_cast<Feedback *>(lv_observer_get_user_data(observer));
+        auto &state = StateBinding::GetTerminalState(subject);
+        feedback->UpdateBuzzer(state);
+        feedback->UpdateLed(state);
+      },
+      this);
+}
+
+Feedback::~Feedback() { lv_observer_remove(observer_); }
+
+void Feedback::UpdateBuzzer(const oww::state::terminal::State &state) {
+  int frequency = 0;
+  int duration = 100;
+
+  std::visit(overloaded{
+                 [&](Idle state) {},
+                 [&](Detected state) { frequency = 440; },
+                 [&](Authenticated state) {
+                   frequency = 660;
+                   duration = 200;
+                 },
+                 [&](StartSession state) {},
+                 [&](Unknown state) {
+                   frequency = 370;
+                   duration = 200;
+                 },
+                 [&](Personalize state) {},
+
+             },
+             state);
+
+  if (frequency > 0) {
+    sink_.Buzz(frequency, duration);
+  }
+}
+
+void Feedback::UpdateLed(const oww::state::terminal::State &state) {
+  constexpr LedColor blue = {.r = 0, .g = 0, .b = 255};
+  constexpr LedColor yellow = {.r = 255, .g = 255, .b = 0};
+  constexpr LedColor green = {.r = 0, .g = 255, .b = 0};
+  constexpr LedColor cyan = {.r = 0, .g = 255, .b = 255};
+  constexpr LedColor red = {.r = 255, .g = 0, .b = 0};
+  constexpr LedColor magenta = {.r = 255, .g = 0, .b = 255};
+
+  // Two short flashes per second.
+  auto error = LedAnimation::Blink(red, 1000, 0b101);
+
+  auto animation = std::visit(
+      overloaded{
+          [&](const Idle &) { return LedAnimation::Pulse(blue, 4000); },
+          [&](const Detected &) { return LedAnimation::Solid(yellow); },
+          [&](const Authenticated &) { return LedAnimation::Solid(green); },
+          [&](const StartSession &session) {
+            return std::visit(
+                overloaded{
+                    [&](const start::Succeeded &) {
+                      return LedAnimation::Solid(cyan);
+                    },
+                    [&](const start::Rejected &) { return error; },
+                    [&](const start::Failed &) { return error; },
+                    // Waiting for the cloud.
+                    [&](const auto &) {
+                      return LedAnimation::Pulse(cyan, 1000);
+                    },
+                },
+                *session.state);
+          },
+          [&](const Unknown &) { return error; },
+          [&](const Personalize &personalization) {
+            auto &nested = *personalization.state;
+            if (std::holds_alternative<personalize::Failed>(nested)) {
+              return error;
+            }
+            // The nested states up to Completed are the steps, Failed is
+            // the last one.
+            constexpr auto steps =
+                std::variant_size_v<personalize::State> - 1;
+            uint8_t progress = (nested.index() + 1) * 255 / steps;
+            return LedAnimation::Progress(magenta, progress);
+          },
+      },
+      state);
+
+  sink_.SetLedAnimation(animation);
+}
+
+}  // namespace oww::ui
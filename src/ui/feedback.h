@@ -0,0 +1,37 @@
+#pragma once
+
+#include "led_animation.h"
+#include "state_binding.h"
+
+namespace oww::ui {
+
+// Buzzer and LED strip of the terminal.
+class FeedbackSink {
+ public:
+  virtual ~FeedbackSink() {};
+
+  // Plays a tone for duration_ms.
+  virtual void Buzz(int frequency, uint32_t duration_ms) = 0;
+
+  virtual void SetLedAnimation(const LedAnimation &animation) = 0;
+};
+
+// Signals the transitions of the terminal state with tones and LED
+// animations, along with the display.
+class Feedback {
+ public:
+  Feedback(StateBinding &binding, FeedbackSink &sink);
+  ~Feedback();
+
+  Feedback(const Feedback &) = delete;
+  Feedback &operator=(const Feedback &) = delete;
+
+ private:
+  FeedbackSink &sink_;
+  lv_observer_t *observer_ = nullptr;
+
+  void UpdateBuzzer(const oww::state::terminal::State &state);
+  void UpdateLed(const oww::state::terminal::State &state);
+};
+
+}  // namespace oww::ui
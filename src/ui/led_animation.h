@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+namespace oww::ui {
+
+struct LedColor {
+  uint8_t r = 0;
+  uint8_t g = 0;
+  uint8_t b = 0;
+
+  bool operator==(const LedColor &other) const {
+    return r == other.r && g == other.g && b == other.b;
+  }
+  bool operator!=(const LedColor &other) const { return !(*this == other); }
+};
+
+// Declarative animation of the LED strip, see LedEngine.
+struct LedAnimation {
+  enum class Type : uint8_t {
+    kOff,
+    kSolid,
+    // Fades the color in and out once per period.
+    kPulse,
+    // Splits the period into 16 steps, the color is shown in the steps set
+    // in pattern (LSB first).
+    kBlink,
+    // Lights the first progress / 255 of the pixels.
+    kProgress,
+  };
+
+  Type type = Type::kOff;
+  LedColor color = {};
+  uint16_t period_ms = 0;
+  uint16_t pattern = 0;
+  uint8_t progress = 0;
+
+  static LedAnimation Solid(LedColor color) {
+    return {.type = Type::kSolid, .color = color};
+  }
+  static LedAnimation Pulse(LedColor color, uint16_t period_ms) {
+    return {.type = Type::kPulse, .color = color, .period_ms = period_ms};
+  }
+  static LedAnimation Blink(LedColor color, uint16_t period_ms,
+                            uint16_t pattern) {
+    return {.type = Type::kBlink,
+            .color = color,
+            .period_ms = period_ms,
+            .pattern = pattern};
+  }
+  static LedAnimation Progress(LedColor color, uint8_t progress) {
+    return {.type = Type::kProgress, .color = color, .progress = progress};
+  }
+
+  bool operator==(const LedAnimation &other) const {
+    return type == other.type && color == other.color &&
+           period_ms == other.period_ms && pattern == other.pattern &&
+           progress == other.progress;
+  }
+  bool operator!=(const LedAnimation &other) const {
+    return !(*this == other);
+  }
+};
+
+}  // namespace oww::ui
@@ -0,0 +1,119 @@
+#include "led_engine.h"
+
+#include <math.h>
+
+namespace oww::ui {
+
+using namespace config::led;
+
+Logger LedEngine::logger("led");
+
+LedEngine::LedEngine(SPIClass &spi) : strip_(spi, pixel_count) {
+  for (size_t i = 0; i < output_table_.size(); i++) {
+    output_table_[i] = lroundf(powf(i / 255.0f, gamma_correction) * brightness);
+  }
+}
+
+Status LedEngine::Begin() {
+  if (thread_ != nullptr) {
+    logger.error("LedEngine::Begin() Already initialized");
+    return Status::kError;
+  }
+
+  auto status = strip_.Begin();
+  if (status != Status::kOk) return status;
+
+  thread_ = new Thread(
+      "LedEngine", [this]() { EngineThread(); }, thread_priority,
+      thread_stack_size);
+
+  return Status::kOk;
+}
+
+void LedEngine::SetAnimation(const LedAnimation &animation) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (animation == animation_) return;
+    animation_ = animation;
+    started_at_ = millis();
+  }
+  animation_changes_.Notify();
+}
+
+os_thread_return_t LedEngine::EngineThread() {
+  while (true) {
+    auto version = animation_changes_.Version();
+
+    LedAnimation animation;
+    system_tick_t started_at;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      animation = animation_;
+      started_at = started_at_;
+    }
+
+    Frame frame;
+    auto timeout = Render(animation, millis() - started_at, frame);
+    if (frame != shown_) {
+      strip_.Show(frame.data());
+      shown_ = frame;
+    }
+
+    animation_changes_.WaitForChange(version, timeout);
+  }
+}
+
+system_tick_t LedEngine::Render(const LedAnimation &animation,
+                                system_tick_t elapsed_ms, Frame &frame) const {
+  using Type = LedAnimation::Type;
+
+  auto period = std::max<system_tick_t>(animation.period_ms, 1);
+  auto phase = elapsed_ms % period;
+
+  switch (animation.type) {
+    case Type::kOff:
+      frame.fill({});
+      return CONCURRENT_WAIT_FOREVER;
+
+    case Type::kSolid:
+      frame.fill(Output(animation.color));
+      return CONCURRENT_WAIT_FOREVER;
+
+    case Type::kPulse: {
+      // Linear ramp up and down, the gamma correction makes it look smooth.
+      auto half = std::max<system_tick_t>(period / 2, 1);
+      auto ramp = phase < half ? phase : period - phase;
+      frame.fill(Output(animation.color, std::min<system_tick_t>(
+                                             ramp * 255 / half, 255)));
+      return frame_interval_ms;
+    }
+
+    case Type::kBlink: {
+      auto step = phase * 16 / period;
+      auto is_on = animation.pattern & (1 << step);
+      frame.fill(is_on ? Output(animation.color) : LedColor{});
+      // Rounded up, so the next frame is rendered in the next step.
+      auto next_step_at = ((step + 1) * period + 15) / 16;
+      return std::max<system_tick_t>(next_step_at - phase, 1);
+    }
+
+    case Type::kProgress: {
+      size_t lit = (animation.progress * frame.size() + 127) / 255;
+      for (size_t i = 0; i < frame.size(); i++) {
+        frame[i] = i < lit ? Output(animation.color) : LedColor{};
+      }
+      return CONCURRENT_WAIT_FOREVER;
+    }
+  }
+
+  return CONCURRENT_WAIT_FOREVER;
+}
+
+LedColor LedEngine::Output(LedColor color, uint8_t level) const {
+  auto scale = [&](uint8_t value) {
+    return output_table_[(value * level + 127) / 255];
+  };
+  return {.r = scale(color.r), .g = scale(color.g), .b = scale(color.b)};
+}
+
+}  // namespace oww::ui
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "common.h"
+#include "common/change_signal.h"
+#include "driver/led_strip.h"
+#include "led_animation.h"
+
+namespace oww::ui {
+
+/**
+ * Plays LedAnimations on the LED strip, from its own thread.
+ *
+ * Colors are mapped through a table combining gamma correction and the
+ * configured brightness. A frame is only sent to the strip if it differs
+ * from the last one, and the thread sleeps until the animation changes the
+ * frame next, i.e. forever for static ones.
+ */
+class LedEngine {
+ public:
+  LedEngine(SPIClass &spi);
+
+  Status Begin();
+
+  // Plays the animation, starting at its beginning unless it is the one
+  // already playing. Thread safe.
+  void SetAnimation(const LedAnimation &animation);
+
+ private:
+  static Logger logger;
+
+  using Frame = std::array<LedColor, config::led::pixel_count>;
+
+  LedStrip strip_;
+  // Output value per color value, see config::led::gamma and brightness.
+  std::array<uint8_t, 256> output_table_;
+
+  std::mutex mutex_;
+  LedAnimation animation_;
+  system_tick_t started_at_ = 0;
+  ChangeSignal animation_changes_;
+
+  Thread *thread_ = nullptr;
+  // Frame last sent to the strip.
+  std::optional<Frame> shown_;
+
+  os_thread_return_t EngineThread();
+
+  // Renders the animation elapsed_ms after its start into frame, returns the
+  // time until the frame changes next.
+  system_tick_t Render(const LedAnimation &animation, system_tick_t elapsed_ms,
+                       Frame &frame) const;
+
+  LedColor Output(LedColor color, uint8_t level = 255) const;
+};
+
+}  // namespace oww::ui
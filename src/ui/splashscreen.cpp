@@ -1,11 +1,13 @@
 #include "splashscreen.h"
 
-LV_IMG_DECLARE(oww_logo);
-
 namespace oww::ui {
 
-SplashScreen::SplashScreen(std::shared_ptr<oww::state::State> state)
-    : Component(state) {
+namespace {
+// Streamed from the OTA assets, see tools/rle_image.py.
+constexpr auto logo_src = "A:oww_logo.rle";
+}  // namespace
+
+SplashScreen::SplashScreen(StateBinding& binding) : Component(binding) {
   lv_obj_set_style_bg_color(lv_screen_active(), lv_color_white(), LV_PART_MAIN);
 
   root_ = lv_obj_create(lv_screen_active());
@@ -16,19 +18,23 @@ SplashScreen::SplashScreen(std::shared_ptr<oww::state::State> state)
   lv_style_init(&style);
   lv_style_set_radius(&style, 5);
 
-  auto logo = lv_image_create(root_);
-
-  lv_image_set_src(logo, &oww_logo);
-
-  // lv_obj_set_size(root_, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-  lv_obj_align(logo, LV_ALIGN_CENTER, 0, 0);
-   
+  // Assets are flashed separately from the firmware and might be missing.
+  lv_image_header_t header;
+  if (lv_image_decoder_get_info(logo_src, &header) == LV_RESULT_OK) {
+    auto logo = lv_image_create(root_);
+    lv_image_set_src(logo, logo_src);
+    lv_obj_align(logo, LV_ALIGN_CENTER, 0, 0);
+  } else {
+    auto label = lv_label_create(root_);
+    lv_label_set_text(label, "Open Werkstatt");
+    lv_obj_align(label, LV_ALIGN_CENTER, 0, 0);
+  }
 };
+
 SplashScreen::~SplashScreen() {
-  // lv_obj_delete(image_);
   lv_obj_delete(root_);
+  // The logo is not shown again, free its RAM for the other screens.
+  lv_image_cache_drop(logo_src);
 }
 
-void SplashScreen::Render() {}
-
-}  // namespace oww::ui
\ No newline at end of file
+}  // namespace oww::ui
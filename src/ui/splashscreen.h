@@ -6,13 +6,8 @@ namespace oww::ui {
 
 class SplashScreen : public Component {
  public:
-  SplashScreen(std::shared_ptr<oww::state::State> state);
+  SplashScreen(StateBinding& binding);
   virtual ~SplashScreen();
-
-  virtual void Render() override;
-
- private:
-  lv_obj_t* image_;
 };
 
 }  // namespace oww::ui
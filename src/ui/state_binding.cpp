@@ -0,0 +1,41 @@
+#include "state_binding.h"
+
+namespace oww::ui {
+
+using namespace oww::state;
+
+StateBinding::StateBinding(std::shared_ptr<terminal::State> terminal_state,
+                           std::shared_ptr<const ConfigSnapshot> config)
+    : terminal_state_value_(terminal_state), config_value_(config) {
+  lv_subject_init_pointer(&terminal_state_, terminal_state_value_.get());
+  lv_subject_init_pointer(&config_, const_cast<ConfigSnapshot*>(
+                                        config_value_.get()));
+}
+
+StateBinding::~StateBinding() {
+  lv_subject_deinit(&terminal_state_);
+  lv_subject_deinit(&config_);
+}
+
+void StateBinding::SetTerminalState(std::shared_ptr<terminal::State> state) {
+  terminal_state_value_ = state;
+  lv_subject_set_pointer(&terminal_state_, terminal_state_value_.get());
+}
+
+void StateBinding::SetConfig(std::shared_ptr<const ConfigSnapshot> config) {
+  if (config->version == config_value_->version) return;
+
+  config_value_ = config;
+  lv_subject_set_pointer(&config_,
+                         const_cast<ConfigSnapshot*>(config_value_.get()));
+}
+
+const terminal::State& StateBinding::GetTerminalState(lv_subject_t* subject) {
+  return *static_cast<const terminal::State*>(lv_subject_get_pointer(subject));
+}
+
+const ConfigSnapshot& StateBinding::GetConfig(lv_subject_t* subject) {
+  return *static_cast<const ConfigSnapshot*>(lv_subject_get_pointer(subject));
+}
+
+}  // namespace oww::ui
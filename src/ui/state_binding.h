@@ -0,0 +1,54 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "state/configuration.h"
+#include "state/terminal/state.h"
+
+namespace oww::ui {
+
+/**
+ * Holds the state shown by the UI in LVGL subjects, which the components and
+ * the buzzer/LED feedback observe.
+ *
+ * Setting a value notifies the observers of its subject, so nothing polls
+ * the state per frame. The subjects hold raw pointers, the values stay alive
+ * until they are replaced. Must be used from the thread running LVGL.
+ *
+ * Doesn't depend on oww::state::State, so the UI can be run off-device with
+ * scripted values, see test/ui_benchmark.cpp.
+ */
+class StateBinding {
+ public:
+  StateBinding(std::shared_ptr<oww::state::terminal::State> terminal_state,
+               std::shared_ptr<const oww::state::ConfigSnapshot> config);
+  ~StateBinding();
+
+  StateBinding(const StateBinding&) = delete;
+  StateBinding& operator=(const StateBinding&) = delete;
+
+  void SetTerminalState(std::shared_ptr<oww::state::terminal::State> state);
+
+  // Only notifies the observers if the config version changed.
+  void SetConfig(std::shared_ptr<const oww::state::ConfigSnapshot> config);
+
+  // Pointer subject of the displayed terminal::State.
+  lv_subject_t* TerminalState() { return &terminal_state_; }
+
+  // Pointer subject of the current ConfigSnapshot.
+  lv_subject_t* Config() { return &config_; }
+
+  // Values of the subjects above, for use in observer callbacks.
+  static const oww::state::terminal::State& GetTerminalState(
+      lv_subject_t* subject);
+  static const oww::state::ConfigSnapshot& GetConfig(lv_subject_t* subject);
+
+ private:
+  lv_subject_t terminal_state_;
+  std::shared_ptr<oww::state::terminal::State> terminal_state_value_;
+
+  lv_subject_t config_;
+  std::shared_ptr<const oww::state::ConfigSnapshot> config_value_;
+};
+
+}  // namespace oww::ui
@@ -2,23 +2,31 @@
 
 namespace oww::ui {
 
-StatusBar::StatusBar(lv_obj_t* parent, std::shared_ptr<oww::state::State> state)
-    : Component(state) {
+StatusBar::StatusBar(lv_obj_t* parent, StateBinding& binding)
+    : Component(binding) {
   root_ = lv_obj_create(parent);
   lv_obj_set_style_bg_color(root_, lv_color_hex(0xdddddd), LV_PART_MAIN);
 
   machine_label_ = lv_label_create(root_);
   lv_obj_align(machine_label_, LV_ALIGN_LEFT_MID, 10, 0);
 
-  auto configuration = state_->GetConfiguration();
-  lv_label_set_text(machine_label_,
-                    configuration->IsConfigured()
-                        ? configuration->GetTerminal()->label.c_str()
-                        : "unconfigured");
+  // Called with the current config right away, and removed along with
+  // root_.
+  lv_subject_add_observer_obj(
+      binding_.Config(),
+      [](lv_observer_t* observer, lv_subject_t* subject) {
+        static_cast<StatusBar*>(lv_observer_get_user_data(observer))
+            ->OnConfigChanged(StateBinding::GetConfig(subject));
+      },
+      root_, this);
 }
 
 StatusBar::~StatusBar() { lv_obj_delete(root_); }
 
-void StatusBar::Render() {}
+void StatusBar::OnConfigChanged(const oww::state::ConfigSnapshot& config) {
+  lv_label_set_text(machine_label_, config.is_configured && config.terminal
+                                        ? config.terminal->label.c_str()
+                                        : "unconfigured");
+}
 
 }  // namespace oww::ui
\ No newline at end of file
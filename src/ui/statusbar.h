@@ -6,13 +6,13 @@ namespace oww::ui {
 
 class StatusBar : public Component {
  public:
-  StatusBar(lv_obj_t* parent, std::shared_ptr<oww::state::State> state);
+  StatusBar(lv_obj_t* parent, StateBinding& binding);
   virtual ~StatusBar();
 
-  virtual void Render() override;
-
  private:
   lv_obj_t* machine_label_ = nullptr;
+
+  void OnConfigChanged(const oww::state::ConfigSnapshot& config);
 };
 
 }  // namespace oww::ui
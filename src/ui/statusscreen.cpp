@@ -0,0 +1,30 @@
+#include "statusscreen.h"
+
+namespace oww::ui {
+
+StatusScreen::StatusScreen(lv_obj_t* parent, StateBinding& binding)
+    : Component(binding) {
+  // Plain container, so the children are laid out as on the screen itself.
+  root_ = lv_obj_create(parent);
+  lv_obj_remove_style_all(root_);
+  lv_obj_set_size(root_, lv_pct(100), lv_pct(100));
+
+  status_bar_ = std::make_unique<StatusBar>(root_, binding);
+
+  lv_obj_set_size(*status_bar_, lv_pct(100), 50);
+  lv_obj_align(*status_bar_, LV_ALIGN_TOP_LEFT, 0, 0);
+
+  tag_status_ = std::make_unique<TagStatus>(root_, binding);
+
+  lv_obj_set_size(*tag_status_, lv_pct(100), 100);
+  lv_obj_align(*tag_status_, LV_ALIGN_TOP_LEFT, 0, 50);
+}
+
+StatusScreen::~StatusScreen() {
+  // The children delete their own widgets first.
+  status_bar_ = nullptr;
+  tag_status_ = nullptr;
+  lv_obj_delete(root_);
+}
+
+}  // namespace oww::ui
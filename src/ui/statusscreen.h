@@ -0,0 +1,20 @@
+#pragma once
+
+#include "component.h"
+#include "statusbar.h"
+#include "tagstatus.h"
+
+namespace oww::ui {
+
+// Main screen, shown after the splash screen.
+class StatusScreen : public Component {
+ public:
+  StatusScreen(lv_obj_t* parent, StateBinding& binding);
+  virtual ~StatusScreen();
+
+ private:
+  std::unique_ptr<StatusBar> status_bar_;
+  std::unique_ptr<TagStatus> tag_status_;
+};
+
+}  // namespace oww::ui
@@ -7,8 +7,8 @@ namespace oww::ui {
 using namespace oww::state;
 using namespace oww::state::terminal;
 
-TagStatus::TagStatus(lv_obj_t* parent, std::shared_ptr<oww::state::State> state)
-    : Component(state) {
+TagStatus::TagStatus(lv_obj_t* parent, StateBinding& binding)
+    : Component(binding) {
   root_ = lv_obj_create(parent);
 
   status_led = lv_led_create(root_);
@@ -17,15 +17,20 @@ TagStatus::TagStatus(lv_obj_t* parent, std::shared_ptr<oww::state::State> state)
 
   status_label = lv_label_create(root_);
   lv_obj_align(status_label, LV_ALIGN_LEFT_MID, 50, 20);
+
+  lv_subject_add_observer_obj(
+      binding_.TerminalState(),
+      [](lv_observer_t* observer, lv_subject_t* subject) {
+        static_cast<TagStatus*>(lv_observer_get_user_data(observer))
+            ->OnTerminalStateChanged(StateBinding::GetTerminalState(subject));
+      },
+      root_, this);
 }
 
 TagStatus::~TagStatus() { lv_obj_delete(root_); }
 
-void TagStatus::Render() {
-  auto current_state = state_->GetTerminalState();
-  if (current_state == last_state_) return;
-
-  last_state_ = current_state;
+void TagStatus::OnTerminalStateChanged(
+    const terminal::State& current_state) {
   String state_string = "?";
   boolean led_on = true;
   auto led_color = lv_palette_main(LV_PALETTE_GREY);
@@ -54,7 +59,7 @@ void TagStatus::Render() {
                  },
 
              },
-             *(current_state.get()));
+             current_state);
 
   lv_label_set_text(status_label, state_string);
   lv_led_set_color(status_led, led_color);
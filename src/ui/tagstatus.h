@@ -7,15 +7,14 @@ namespace oww::ui {
 
 class TagStatus : public Component {
  public:
-  TagStatus(lv_obj_t* parent, std::shared_ptr<oww::state::State> state);
+  TagStatus(lv_obj_t* parent, StateBinding& binding);
   virtual ~TagStatus();
 
-  virtual void Render() override;
-
  private:
-  std::shared_ptr<oww::state::terminal::State> last_state_;
   lv_obj_t* status_led = nullptr;
   lv_obj_t* status_label = nullptr;
+
+  void OnTerminalStateChanged(const oww::state::terminal::State& state);
 };
 
 }  // namespace oww::ui
@@ -1,6 +1,9 @@
 #include "ui.h"
 
 #include "../state/configuration.h"
+#include "common/boot_timeline.h"
+#include "asset/asset_fs.h"
+#include "asset/rle_image_decoder.h"
 #include "driver/display.h"
 
 namespace oww::ui {
@@ -19,7 +22,7 @@ UserInterface &UserInterface::instance() {
 }
 
 UserInterface::UserInterface()
-    : led_strip_(config::led::pixel_count, SPI, config::led::pixel_type) {}
+    : led_engine_(SPI) {}
 
 UserInterface::~UserInterface() {}
 
@@ -35,10 +38,7 @@ tl::expected<void, Error> UserInterface::Begin(
   pinMode(buzzer::pin_pwm, OUTPUT);
   analogWrite(config::ui::display::pin_backlight, 255);
 
-  led_strip_.begin();
-  led_strip_.show();
-
-  Display::instance().Begin();
+  led_engine_.Begin();
 
   os_mutex_create(&mutex_);
 
@@ -52,124 +52,87 @@ tl::expected<void, Error> UserInterface::Begin(
 os_thread_return_t UserInterface::UserInterfaceThread() {
   auto display = &Display::instance();
 
-  splash_screen_ = std::make_unique<SplashScreen>(state_);
-
-  while (true) {
-    UpdateGui();
-    UpdateBuzzer();
-    UpdateLed();
-    display->RenderLoop();
+  // The display is reset while the state loads.
+  if (display->Begin([this]() { state_->WakeDisplay(); }) != Status::kOk) {
+    logger.error("Initialization of the display failed");
   }
-}
-
-void UserInterface::UpdateGui() {
-  if (splash_screen_) {
-    splash_screen_->Render();
-    if (millis() < 50000) {
-      return;
-    }
+  AssetFs::Begin();
+  RleImageDecoder::Begin();
+  BootTimeline::instance().Mark(BootStage::kDisplay);
 
-    splash_screen_ = nullptr;
-    status_bar_ = std::make_unique<StatusBar>(lv_screen_active(), state_);
+  BootTimeline::instance().WaitFor(BootStage::kState);
 
-    lv_obj_set_size(*status_bar_, lv_pct(100), 50);
-    lv_obj_align(*status_bar_, LV_ALIGN_TOP_LEFT, 0, 0);
+  terminal_state_version_ = state_->GetTerminalStateVersion();
+  binding_ = std::make_unique<StateBinding>(
+      state_->GetTerminalState(), state_->GetConfiguration()->GetSnapshot());
 
-    tag_status_ = std::make_unique<TagStatus>(lv_screen_active(), state_);
+  buzz_timer_ = lv_timer_create(
+      [](lv_timer_t *timer) {
+        logger.error("Stopping buzzer");
+        analogWrite(buzzer::pin_pwm, 0);
+        lv_timer_pause(timer);
+      },
+      0, nullptr);
+  lv_timer_pause(buzz_timer_);
 
-    lv_obj_set_size(*tag_status_, lv_pct(100), 100);
-    lv_obj_align(*tag_status_, LV_ALIGN_TOP_LEFT, 0, 50);
-  }
-  if (status_bar_) {
-    status_bar_->Render();
-  }
-  if (tag_status_) {
-    tag_status_->Render();
-  }
-}
+  feedback_ = std::make_unique<Feedback>(*binding_, *this);
 
-void UserInterface::UpdateBuzzer() {
-  auto current_state = state_->GetTerminalState();
+  splash_screen_ = std::make_unique<SplashScreen>(*binding_);
 
-  if (last_buzz_state_id_ != static_cast<void *>(current_state.get())) {
-    using namespace oww::state::terminal;
+  auto splash_timer = lv_timer_create(
+      [](lv_timer_t *timer) {
+        static_cast<UserInterface *>(lv_timer_get_user_data(timer))
+            ->ShowStatusScreen();
+      },
+      splash_screen_ms, this);
+  lv_timer_set_repeat_count(splash_timer, 1);
 
-    int frequency = 0;
-    int duration = 100;
+  while (true) {
+    auto display_version = state_->GetDisplayVersion();
 
-    std::visit(overloaded{
-                   [&](Idle state) {},
-                   [&](Detected state) { frequency = 440; },
-                   [&](Authenticated state) {
-                     frequency = 660;
-                     duration = 200;
-                   },
-                   [&](StartSession state) {},
-                   [&](Unknown state) {
-                     frequency = 370;
-                     duration = 200;
-                   },
-                   [&](Personalize state) {},
+    UpdateBinding();
 
-               },
-               *(current_state.get()));
+    // Runs the due LVGL timers and renders what got invalidated. Returns the
+    // time until the next timer or animation is due, if any.
+    system_tick_t timeout = display->RenderLoop();
+    BootTimeline::instance().Mark(BootStage::kUserInterface);
 
-    if (frequency > 0) {
-      logger.error("Buzzing with frequency %d", frequency);
+    // Sleep until then, or until something shown changed.
+    state_->WaitForDisplayChange(display_version, timeout);
+  }
+}
 
-      analogWrite(buzzer::pin_pwm, 128, frequency);
+void UserInterface::UpdateBinding() {
+  // The version is read first, so a transition racing with
+  // GetTerminalState() is taken over again on the next update rather than
+  // missed.
+  auto version = state_->GetTerminalStateVersion();
+  if (version != terminal_state_version_) {
+    terminal_state_version_ = version;
+    binding_->SetTerminalState(state_->GetTerminalState());
+  }
 
-      buzz_timeout = millis() + duration;
-    }
+  binding_->SetConfig(state_->GetConfiguration()->GetSnapshot());
+}
 
-    last_buzz_state_id_ = static_cast<void *>(current_state.get());
-  }
+void UserInterface::ShowStatusScreen() {
+  splash_screen_ = nullptr;
+  status_screen_ =
+      std::make_unique<StatusScreen>(lv_screen_active(), *binding_);
+}
 
-  if (buzz_timeout != CONCURRENT_WAIT_FOREVER && buzz_timeout < millis()) {
-    logger.error("Stopping buzzer");
+void UserInterface::Buzz(int frequency, uint32_t duration_ms) {
+  logger.error("Buzzing with frequency %d", frequency);
 
-    analogWrite(buzzer::pin_pwm, 0);
+  analogWrite(buzzer::pin_pwm, 128, frequency);
 
-    buzz_timeout = CONCURRENT_WAIT_FOREVER;
-  }
+  lv_timer_set_period(buzz_timer_, duration_ms);
+  lv_timer_reset(buzz_timer_);
+  lv_timer_resume(buzz_timer_);
 }
 
-void UserInterface::UpdateLed() {
-  auto current_state = state_->GetTerminalState();
-
-  using namespace oww::state::terminal;
-
-  byte r = 0;
-  byte g = 0;
-  byte b = 0;
-
-  std::visit(overloaded{
-                 [&](Idle state) { b = 255; },  // Blue
-                 [&](Detected state) {
-                   r = 255;
-                   g = 255;
-                 },                                      // Yellow
-                 [&](Authenticated state) { g = 255; },  // Green
-                 [&](StartSession state) {
-                   g = 255;
-                   b = 255;
-                 },                                // Cyan
-                 [&](Unknown state) { r = 255; },  // Red
-                 [&](Personalize state) {
-                   r = 255;
-                   b = 255;
-                 },  // Magenta
-
-             },
-             *(current_state.get()));
-
-  byte scaling = 20;  // sin((millis() / 5000.0) * TWO_PI) * 15 + 20;
-
-  for (size_t i = 0; i < led_strip_.numPixels(); i++) {
-    led_strip_.setColorScaled(i, r, g, b, scaling);
-  }
-
-  led_strip_.show();
+void UserInterface::SetLedAnimation(const LedAnimation &animation) {
+  led_engine_.SetAnimation(animation);
 }
 
 }  // namespace oww::ui
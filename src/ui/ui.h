@@ -1,14 +1,14 @@
 #pragma once
 
-#include <XPT2046_Touch.h>
 #include <lvgl.h>
 
 #include "common.h"
-#include "neopixel.h"
+#include "feedback.h"
+#include "led_engine.h"
 #include "splashscreen.h"
 #include "state/state.h"
-#include "statusbar.h"
-#include "tagstatus.h"
+#include "state_binding.h"
+#include "statusscreen.h"
 
 namespace oww::ui {
 
@@ -18,7 +18,7 @@ enum class Error : int {
   kIllegalArgument = 2,
 };
 
-class UserInterface {
+class UserInterface : public FeedbackSink {
  public:
   static UserInterface &instance();
 
@@ -63,19 +63,28 @@ class UserInterface {
 
   os_thread_return_t UserInterfaceThread();
 
-  void UpdateGui();
+  // Takes the terminal state and config over into binding_.
+  void UpdateBinding();
 
-  system_tick_t buzz_timeout = CONCURRENT_WAIT_FOREVER;
-  void *last_buzz_state_id_ = nullptr;
+  // Replaces the splash screen with the status screen.
+  void ShowStatusScreen();
 
-  void UpdateBuzzer();
-  void UpdateLed();
+  // Stops the buzzer once the tone played for its duration.
+  lv_timer_t *buzz_timer_ = nullptr;
+
+  // FeedbackSink, driving the buzzer pin and the LED strip.
+  virtual void Buzz(int frequency, uint32_t duration_ms) override;
+  virtual void SetLedAnimation(const LedAnimation &animation) override;
 
  private:
-  Adafruit_NeoPixel led_strip_;
+  LedEngine led_engine_;
+  // Created on the UI thread, as LVGL is not thread safe.
+  std::unique_ptr<StateBinding> binding_ = nullptr;
+  // Terminal state version held by binding_.
+  uint32_t terminal_state_version_ = 0;
+  std::unique_ptr<Feedback> feedback_ = nullptr;
   std::unique_ptr<SplashScreen> splash_screen_ = nullptr;
-  std::unique_ptr<StatusBar> status_bar_ = nullptr;
-  std::unique_ptr<TagStatus> tag_status_ = nullptr;
+  std::unique_ptr<StatusScreen> status_screen_ = nullptr;
 };
 
 }  // namespace oww::ui
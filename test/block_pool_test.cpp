@@ -0,0 +1,60 @@
+#include "common/block_pool.h"
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+using TestPool = BlockPool<128, 4>;
+
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooled(TestPool &pool, Args &&...args) {
+  return std::allocate_shared<T>(PoolAllocator<T, TestPool>(pool),
+                                 std::forward<Args>(args)...);
+}
+
+int main(int argc, char *argv[]) {
+  // Objects are served from the pool and returned on release
+  {
+    TestPool pool;
+    {
+      auto value = MakePooled<std::string>(pool, "pooled");
+      assert(*value == "pooled");
+      assert(pool.GetStats().in_use == 1);
+    }
+    auto stats = pool.GetStats();
+    assert(stats.pool_allocations == 1);
+    assert(stats.heap_allocations == 0);
+    assert(stats.in_use == 0);
+  }
+  // Blocks are reused
+  {
+    TestPool pool;
+    for (int i = 0; i < 100; i++) {
+      auto value = MakePooled<int>(pool, i);
+      assert(*value == i);
+    }
+    auto stats = pool.GetStats();
+    assert(stats.pool_allocations == 100);
+    assert(stats.heap_allocations == 0);
+    assert(stats.high_watermark == 1);
+  }
+  // Exhausted pool falls back to the heap
+  {
+    TestPool pool;
+    std::vector<std::shared_ptr<int>> values;
+    for (int i = 0; i < 6; i++) values.push_back(MakePooled<int>(pool, i));
+
+    auto stats = pool.GetStats();
+    assert(stats.pool_allocations == 4);
+    assert(stats.heap_allocations == 2);
+
+    values.clear();
+    assert(pool.GetStats().in_use == 0);
+  }
+  // Oversized objects fall back to the heap
+  {
+    TestPool pool;
+    auto value = MakePooled<std::array<uint8_t, 256>>(pool);
+    assert(pool.GetStats().heap_allocations == 1);
+  }
+}
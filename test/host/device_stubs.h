@@ -0,0 +1,30 @@
+#pragma once
+
+// Symbols of the P2's Device OS that config.h uses, but UnitTestLib does not
+// provide. Force-included into the host build of the UI, the values only
+// need to compile.
+
+#include "Particle.h"
+
+#ifndef D10
+#define D10 10
+#endif
+#ifndef D12
+#define D12 12
+#endif
+#ifndef S3
+#define S3 18
+#endif
+#ifndef S4
+#define S4 19
+#endif
+
+#ifndef OS_THREAD_PRIORITY_DEFAULT
+#define OS_THREAD_PRIORITY_DEFAULT 2
+#endif
+#ifndef OS_THREAD_STACK_SIZE_DEFAULT
+#define OS_THREAD_STACK_SIZE_DEFAULT 3072
+#endif
+#ifndef OS_THREAD_STACK_SIZE_DEFAULT_HIGH
+#define OS_THREAD_STACK_SIZE_DEFAULT_HIGH 8192
+#endif
@@ -0,0 +1,42 @@
+#include "framebuffer_display.h"
+
+#include <cstring>
+
+FramebufferDisplay::FramebufferDisplay(int32_t width, int32_t height)
+    : width_(width),
+      buffer_1_(width * height * pixel_size),
+      buffer_2_(width * height * pixel_size),
+      framebuffer_(width * height * pixel_size) {
+  display_ = lv_display_create(width, height);
+  lv_display_set_color_format(display_, LV_COLOR_FORMAT_RGB565_SWAPPED);
+  lv_display_set_user_data(display_, this);
+  lv_display_set_flush_cb(
+      display_, [](lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+        static_cast<FramebufferDisplay *>(lv_display_get_user_data(disp))
+            ->Flush(area, px_map);
+      });
+  lv_display_set_buffers(display_, buffer_1_.data(), buffer_2_.data(),
+                         buffer_1_.size(), LV_DISPLAY_RENDER_MODE_DIRECT);
+}
+
+FramebufferDisplay::~FramebufferDisplay() { lv_display_delete(display_); }
+
+size_t FramebufferDisplay::TakeFlushedBytes() {
+  auto bytes = flushed_bytes_;
+  flushed_bytes_ = 0;
+  return bytes;
+}
+
+void FramebufferDisplay::Flush(const lv_area_t *area, uint8_t *px_map) {
+  size_t stride = width_ * pixel_size;
+  size_t row_size = lv_area_get_width(area) * pixel_size;
+  size_t offset = area->y1 * stride + area->x1 * pixel_size;
+
+  for (int32_t y = area->y1; y <= area->y2; y++) {
+    memcpy(framebuffer_.data() + offset, px_map + offset, row_size);
+    offset += stride;
+  }
+
+  flushed_bytes_ += row_size * lv_area_get_height(area);
+  lv_display_flush_ready(display_);
+}
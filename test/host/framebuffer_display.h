@@ -0,0 +1,35 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+#include <vector>
+
+// LVGL display rendering into memory, set up like the device's Display: two
+// full frame buffers in direct mode, and only the invalidated areas are
+// flushed, here into a framebuffer standing in for the panel.
+class FramebufferDisplay {
+ public:
+  FramebufferDisplay(int32_t width, int32_t height);
+  ~FramebufferDisplay();
+
+  FramebufferDisplay(const FramebufferDisplay &) = delete;
+  FramebufferDisplay &operator=(const FramebufferDisplay &) = delete;
+
+  // Returns the pixel bytes flushed since the last call.
+  size_t TakeFlushedBytes();
+
+  const std::vector<uint8_t> &Framebuffer() const { return framebuffer_; }
+
+ private:
+  static constexpr size_t pixel_size = 2;
+
+  const int32_t width_;
+  lv_display_t *display_ = nullptr;
+  std::vector<uint8_t> buffer_1_;
+  std::vector<uint8_t> buffer_2_;
+  std::vector<uint8_t> framebuffer_;
+  size_t flushed_bytes_ = 0;
+
+  void Flush(const lv_area_t *area, uint8_t *px_map);
+};
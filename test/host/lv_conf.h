@@ -0,0 +1,25 @@
+// LVGL configuration of the host build, see test/ui_benchmark.cpp. Options
+// not set here use the LVGL defaults.
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+// The builtin allocator, so lv_mem_monitor() reports the heap use.
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_CLIB
+#define LV_MEM_SIZE (128 * 1024U)
+
+#define LV_USE_OS LV_OS_NONE
+#define LV_DEF_REFR_PERIOD 33
+
+#define LV_USE_OBSERVER 1
+#define LV_USE_LED 1
+#define LV_USE_LOG 0
+
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+#endif  // LV_CONF_H
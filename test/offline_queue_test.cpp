@@ -0,0 +1,154 @@
+#include "state/offline_queue.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstdlib>
+
+using oww::state::OfflineQueue;
+
+// Each case works on a fresh directory, as the queue persists across
+// instances.
+std::string MakeDirectory() {
+  char path[] = "/tmp/offline_queue_test.XXXXXX";
+  assert(mkdtemp(path));
+  return path;
+}
+
+void Append(OfflineQueue &queue, const char *command, uint8_t value) {
+  uint8_t payload[] = {value, value, value};
+  assert(queue.Append(command, payload, sizeof(payload)) == Status::kOk);
+}
+
+// Reads the record at offset and checks it matches Append(command, value).
+uint32_t ExpectRecord(OfflineQueue &queue, uint32_t offset,
+                      const char *command, uint8_t value) {
+  OfflineQueue::Record record;
+  auto next = queue.Read(offset, record);
+  assert(next.has_value());
+  assert(record.command == command);
+  assert(record.payload_size == 3);
+  assert(record.payload[0] == value && record.payload[2] == value);
+  return next.value();
+}
+
+off_t GetLogSize(const std::string &directory) {
+  struct stat st;
+  auto path = directory + "/offline_queue.bin";
+  return stat(path.c_str(), &st) == 0 ? st.st_size : 0;
+}
+
+int main(int argc, char *argv[]) {
+  // Appended records are read back in order
+  {
+    auto directory = MakeDirectory();
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    assert(!queue.HasRecord(queue.GetCursor()));
+
+    Append(queue, "endSession", 1);
+    Append(queue, "endSession", 2);
+
+    auto offset = queue.GetCursor();
+    offset = ExpectRecord(queue, offset, "endSession", 1);
+    offset = ExpectRecord(queue, offset, "endSession", 2);
+    assert(!queue.HasRecord(offset));
+  }
+  // A partial commit keeps the records after the offset
+  {
+    auto directory = MakeDirectory();
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    Append(queue, "a", 1);
+    Append(queue, "b", 2);
+
+    OfflineQueue::Record record;
+    auto second = queue.Read(queue.GetCursor(), record).value();
+    assert(queue.Commit(second) == Status::kOk);
+
+    assert(queue.GetCursor() == second);
+    auto end = ExpectRecord(queue, queue.GetCursor(), "b", 2);
+    assert(!queue.HasRecord(end));
+  }
+  // Committing all records deletes the log, offsets stay increasing
+  {
+    auto directory = MakeDirectory();
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    Append(queue, "a", 1);
+
+    auto end = ExpectRecord(queue, queue.GetCursor(), "a", 1);
+    assert(queue.Commit(end) == Status::kOk);
+    assert(!queue.HasRecord(queue.GetCursor()));
+    assert(GetLogSize(directory) == 0);
+
+    Append(queue, "b", 2);
+    assert(queue.GetCursor() >= end);
+    ExpectRecord(queue, queue.GetCursor(), "b", 2);
+  }
+  // Records and the cursor survive reopening the queue
+  {
+    auto directory = MakeDirectory();
+    uint32_t second;
+    {
+      OfflineQueue queue(directory.c_str());
+      assert(queue.Begin() == Status::kOk);
+      Append(queue, "a", 1);
+      Append(queue, "b", 2);
+      Append(queue, "c", 3);
+      second = ExpectRecord(queue, queue.GetCursor(), "a", 1);
+      assert(queue.Commit(second) == Status::kOk);
+    }
+
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    assert(queue.GetCursor() == second);
+    auto offset = ExpectRecord(queue, queue.GetCursor(), "b", 2);
+    offset = ExpectRecord(queue, offset, "c", 3);
+    assert(!queue.HasRecord(offset));
+  }
+  // A partial record left by a power loss is dropped on reopening
+  {
+    auto directory = MakeDirectory();
+    {
+      OfflineQueue queue(directory.c_str());
+      assert(queue.Begin() == Status::kOk);
+      Append(queue, "a", 1);
+      Append(queue, "b", 2);
+    }
+    auto path = directory + "/offline_queue.bin";
+    assert(truncate(path.c_str(), GetLogSize(directory) - 1) == 0);
+
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    auto end = ExpectRecord(queue, queue.GetCursor(), "a", 1);
+    assert(!queue.HasRecord(end));
+    assert(GetLogSize(directory) == end);
+  }
+  // A corrupt record is dropped on its own
+  {
+    auto directory = MakeDirectory();
+    OfflineQueue queue(directory.c_str());
+    assert(queue.Begin() == Status::kOk);
+    Append(queue, "a", 1);
+    Append(queue, "b", 2);
+
+    // Flip the last payload byte of the first record.
+    OfflineQueue::Record record;
+    auto second = queue.Read(queue.GetCursor(), record).value();
+    auto path = directory + "/offline_queue.bin";
+    int fd = open(path.c_str(), O_WRONLY);
+    uint8_t corrupt = 0xff;
+    assert(pwrite(fd, &corrupt, 1, second - 1) == 1);
+    close(fd);
+
+    auto read = queue.Read(queue.GetCursor(), record);
+    assert(!read && read.error() == OfflineQueue::ReadError::kCorrupt);
+
+    assert(queue.DropCorrupt() == Status::kOk);
+    assert(queue.GetCursor() == second);
+    ExpectRecord(queue, second, "b", 2);
+  }
+}
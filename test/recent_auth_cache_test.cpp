@@ -0,0 +1,56 @@
+#include "common/recent_auth_cache.h"
+
+#include <cassert>
+
+TagUid MakeUid(uint8_t last_byte) {
+  return {0x04, 0x11, 0x22, 0x33, 0x44, 0x55, last_byte};
+}
+
+int main(int argc, char *argv[]) {
+  // Tokens are found per tag and machine
+  {
+    RecentAuthCache<4> cache(1000);
+    cache.Store(1, MakeUid(1), "token-1", 0);
+
+    assert(cache.Lookup(1, MakeUid(1), 10) == "token-1");
+    assert(!cache.Lookup(2, MakeUid(1), 10));
+    assert(!cache.Lookup(1, MakeUid(2), 10));
+  }
+  // Tokens expire after the window
+  {
+    RecentAuthCache<4> cache(1000);
+    cache.Store(1, MakeUid(1), "token-1", 500);
+
+    assert(cache.Lookup(1, MakeUid(1), 1499));
+    assert(!cache.Lookup(1, MakeUid(1), 1500));
+  }
+  // The window survives a wrap-around of the tick counter
+  {
+    RecentAuthCache<4> cache(1000);
+    cache.Store(1, MakeUid(1), "token-1", 0xffffff00);
+
+    assert(cache.Lookup(1, MakeUid(1), 0x100));
+    assert(!cache.Lookup(1, MakeUid(1), 0x400));
+  }
+  // A new session replaces the token, erased tokens are gone
+  {
+    RecentAuthCache<4> cache(1000);
+    cache.Store(1, MakeUid(1), "token-1", 0);
+    cache.Store(1, MakeUid(1), "token-2", 10);
+    assert(cache.Lookup(1, MakeUid(1), 20) == "token-2");
+
+    cache.Erase(1, MakeUid(1), 30);
+    assert(!cache.Lookup(1, MakeUid(1), 40));
+  }
+  // A full cache evicts the oldest token
+  {
+    RecentAuthCache<2> cache(1000);
+    cache.Store(1, MakeUid(1), "token-1", 0);
+    cache.Store(1, MakeUid(2), "token-2", 10);
+    cache.Store(1, MakeUid(3), "token-3", 20);
+
+    assert(!cache.Lookup(1, MakeUid(1), 30));
+    assert(cache.Lookup(1, MakeUid(2), 30) == "token-2");
+    assert(cache.Lookup(1, MakeUid(3), 30) == "token-3");
+  }
+}
@@ -0,0 +1,88 @@
+#include "common/runtime_meter.h"
+
+#include <cassert>
+
+constexpr uint32_t forever = UINT32_MAX;
+
+RuntimeMeter::Session MakeSession(uint8_t uid, uint32_t started_at,
+                                  uint32_t deadline = forever) {
+  return {
+      .tag_uid = {0x04, 0x11, 0x22, 0x33, 0x44, 0x55, uid},
+      .started_at = started_at,
+      .deadline = deadline,
+  };
+}
+
+int main(int argc, char *argv[]) {
+  // A session counts whole seconds, the remainder carries over
+  {
+    RuntimeMeter meter;
+    auto counted = meter.Update(MakeSession(1, 1000), 1000);
+    assert(counted.started && counted.seconds == 0);
+
+    counted = meter.Update(MakeSession(1, 1000), 2500);
+    assert(!counted.started && counted.seconds == 1);
+
+    counted = meter.Update(MakeSession(1, 1000), 2900);
+    assert(counted.seconds == 0);
+
+    counted = meter.Update(MakeSession(1, 1000), 3000);
+    assert(counted.seconds == 1);
+  }
+  // A session in its timeout counts until its deadline, not beyond
+  {
+    RuntimeMeter meter;
+    meter.Update(MakeSession(1, 0), 0);
+    auto counted = meter.Update(MakeSession(1, 0, 10000), 4000);
+    assert(counted.seconds == 4);
+
+    counted = meter.Update(MakeSession(1, 0, 10000), 25000);
+    assert(counted.seconds == 6);
+
+    counted = meter.Update(MakeSession(1, 0, 10000), 30000);
+    assert(counted.seconds == 0);
+
+    counted = meter.Update(std::nullopt, 31000);
+    assert(counted.ended_seconds == 0 && counted.seconds == 0);
+  }
+  // A session replaced during its timeout stops counting at the replacement,
+  // even if the meter only sees it afterwards
+  {
+    RuntimeMeter meter;
+    meter.Update(MakeSession(1, 0), 0);
+    meter.Update(MakeSession(1, 0, 60000), 5000);
+
+    // Another tag took over the machine at 8000.
+    auto counted = meter.Update(MakeSession(2, 8000), 12000);
+    assert(counted.ended_seconds == 3);
+    assert(counted.started);
+    assert(counted.seconds == 4);
+  }
+  // The same tag tapped again starts a new session
+  {
+    RuntimeMeter meter;
+    meter.Update(MakeSession(1, 0), 0);
+    meter.Update(MakeSession(1, 0, 20000), 2000);
+
+    auto counted = meter.Update(MakeSession(1, 3000), 3000);
+    assert(counted.ended_seconds == 1);
+    assert(counted.started && counted.seconds == 0);
+  }
+  // A removed session counts until its removal was seen
+  {
+    RuntimeMeter meter;
+    meter.Update(MakeSession(1, 0), 0);
+    meter.Update(MakeSession(1, 0), 1500);
+
+    auto counted = meter.Update(std::nullopt, 3000);
+    assert(counted.ended_seconds == 2);
+    assert(!counted.started && counted.seconds == 0);
+  }
+  // Counting survives a wrap-around of the tick counter
+  {
+    RuntimeMeter meter;
+    meter.Update(MakeSession(1, 0xfffff000), 0xfffff000);
+    auto counted = meter.Update(MakeSession(1, 0xfffff000), 0x1000);
+    assert(counted.seconds == 8);
+  }
+}
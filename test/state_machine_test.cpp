@@ -0,0 +1,112 @@
+#include "common/state_machine.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+struct Idle {};
+struct Running {
+  int count;
+};
+struct Stopped {
+  std::string reason;
+};
+
+using State = std::variant<Idle, Running, Stopped>;
+
+using Transitions =
+    TransitionTable<Transition<Idle, Running>, Transition<Running, Running>,
+                    Transition<Running, Stopped>>;
+
+static_assert(Transitions::Allows<Idle, Running>());
+static_assert(Transitions::Allows<Running, Stopped>());
+static_assert(!Transitions::Allows<Running, Idle>());
+static_assert(!Transitions::Allows<Stopped, Running>());
+
+// Checked transition, as used by the terminal flows.
+template <typename From, typename To>
+void TransitionTo(State &state, const From &, To to) {
+  static_assert(Transitions::Allows<From, To>(), "Illegal transition");
+  state = std::move(to);
+}
+
+template <class... Ts>
+struct overloaded : Ts... {
+  using Ts::operator()...;
+};
+template <class... Ts>
+overloaded(Ts...) -> overloaded<Ts...>;
+
+// One step of the test machine: Idle -> Running(0..limit) -> Stopped.
+int Step(State &state, int limit) {
+  return Dispatch(state, overloaded{
+                             [&](Idle &idle) {
+                               TransitionTo(state, idle, Running{.count = 0});
+                               return 0;
+                             },
+                             [&](Running &running) {
+                               auto count = running.count + 1;
+                               if (count < limit) {
+                                 TransitionTo(state, running,
+                                              Running{.count = count});
+                               } else {
+                                 TransitionTo(state, running,
+                                              Stopped{.reason = "limit"});
+                               }
+                               return count;
+                             },
+                             [](Stopped &) { return -1; },
+                         });
+}
+
+int main(int argc, char *argv[]) {
+  // Dispatch calls the handler of the active state
+  {
+    State state = Running{.count = 41};
+    auto count = Dispatch(state, overloaded{
+                                     [](Running &running) {
+                                       return running.count + 1;
+                                     },
+                                     [](auto &) { return 0; },
+                                 });
+    assert(count == 42);
+
+    const State stopped = Stopped{.reason = "done"};
+    auto reason = Dispatch(stopped, overloaded{
+                                        [](const Stopped &stopped) {
+                                          return stopped.reason;
+                                        },
+                                        [](const auto &) {
+                                          return std::string();
+                                        },
+                                    });
+    assert(reason == "done");
+  }
+  // The machine walks through its declared transitions
+  {
+    State state = Idle{};
+    assert(Step(state, 3) == 0);
+    assert(std::get<Running>(state).count == 0);
+    assert(Step(state, 3) == 1);
+    assert(Step(state, 3) == 2);
+    assert(Step(state, 3) == 3);
+    assert(std::get<Stopped>(state).reason == "limit");
+    assert(Step(state, 3) == -1);
+  }
+  // Transition throughput
+  {
+    constexpr int transitions = 10000000;
+    State state = Idle{};
+
+    auto start = std::chrono::steady_clock::now();
+    while (Step(state, transitions) >= 0) {
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    printf("%d transitions in %lld ms, %.1f ns per transition\n", transitions,
+           static_cast<long long>(ns.count() / 1000000),
+           static_cast<double>(ns.count()) / transitions);
+  }
+}
@@ -0,0 +1,118 @@
+#include "nfc/tag_session_arbiter.h"
+
+#include <array>
+#include <cassert>
+#include <vector>
+
+// Models the PN532 selecting a target for each exchange: switching to
+// another target deselects the active one, which drops the authentication of
+// its NTAG 424.
+struct FakePcd {
+  std::optional<size_t> active;
+  std::array<bool, 2> authenticated = {};
+  std::array<int, 2> exchanges_without_auth = {};
+
+  void Select(size_t target) {
+    if (active && *active != target) authenticated[*active] = false;
+    active = target;
+  }
+
+  void Authenticate(size_t target) {
+    Select(target);
+    authenticated[target] = true;
+  }
+
+  void AuthenticatedExchange(size_t target) {
+    Select(target);
+    if (!authenticated[target]) exchanges_without_auth[target]++;
+  }
+
+  void CheckPresence(size_t target) { Select(target); }
+};
+
+// Session of a tag in the shape of the StartSession flow: identified and
+// authenticated (DetectTag), EV2 authentication part 1, waiting for the
+// cloud, part 2, then idle with presence checks.
+struct FakeTagSession {
+  enum Step { kListed, kPart1, kAwaitCloud, kPart2, kIdle };
+  Step step = kListed;
+  int cloud_passes = 3;
+};
+
+// One pass of each listed target, following the NfcTags worker.
+void RunPass(FakePcd &pcd, TagSessionArbiter *arbiter,
+             std::array<FakeTagSession, 2> &sessions) {
+  for (size_t target = 0; target < sessions.size(); target++) {
+    if (arbiter && !arbiter->MayExchange(target)) continue;
+
+    auto &session = sessions[target];
+    switch (session.step) {
+      case FakeTagSession::kListed:
+        if (arbiter) arbiter->Begin(target);
+        pcd.Authenticate(target);
+        session.step = FakeTagSession::kPart1;
+        break;
+      case FakeTagSession::kPart1:
+        pcd.CheckPresence(target);
+        pcd.AuthenticatedExchange(target);
+        session.step = FakeTagSession::kAwaitCloud;
+        break;
+      case FakeTagSession::kAwaitCloud:
+        pcd.CheckPresence(target);
+        if (--session.cloud_passes == 0) session.step = FakeTagSession::kPart2;
+        break;
+      case FakeTagSession::kPart2:
+        pcd.AuthenticatedExchange(target);
+        session.step = FakeTagSession::kIdle;
+        if (arbiter) arbiter->End(target);
+        break;
+      case FakeTagSession::kIdle:
+        pcd.CheckPresence(target);
+        break;
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  // Without arbitration, the presence checks of the other target break the
+  // authentication in between EV2 part 1 and part 2
+  {
+    FakePcd pcd;
+    std::array<FakeTagSession, 2> sessions;
+    for (int pass = 0; pass < 10; pass++) RunPass(pcd, nullptr, sessions);
+
+    assert(pcd.exchanges_without_auth[0] > 0);
+    assert(pcd.exchanges_without_auth[1] > 0);
+  }
+  // Two tags listed together complete their sessions one after another
+  {
+    FakePcd pcd;
+    TagSessionArbiter arbiter;
+    std::array<FakeTagSession, 2> sessions;
+
+    RunPass(pcd, &arbiter, sessions);
+    assert(arbiter.GetHolder() == 0);
+    assert(sessions[1].step == FakeTagSession::kListed);
+
+    for (int pass = 0; pass < 20; pass++) RunPass(pcd, &arbiter, sessions);
+
+    assert(sessions[0].step == FakeTagSession::kIdle);
+    assert(sessions[1].step == FakeTagSession::kIdle);
+    assert(!arbiter.GetHolder());
+    assert(pcd.exchanges_without_auth[0] == 0);
+    assert(pcd.exchanges_without_auth[1] == 0);
+  }
+  // The idle target is not polled while the other target holds the PN532
+  {
+    TagSessionArbiter arbiter;
+    arbiter.Begin(1);
+    assert(!arbiter.MayExchange(0));
+    assert(arbiter.MayExchange(1));
+
+    // Ending a session the target does not hold changes nothing.
+    arbiter.End(0);
+    assert(arbiter.GetHolder() == 1);
+    arbiter.End(1);
+    assert(arbiter.MayExchange(0));
+  }
+}
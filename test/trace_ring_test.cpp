@@ -0,0 +1,83 @@
+#include "common/trace_ring.h"
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+  // Records are popped in order, with their data
+  {
+    TraceRing<4> ring;
+    uint8_t data[] = {0x01, 0x02, 0x03};
+    assert(ring.TryPush(nullptr, "first %lu", 1, 10, data, sizeof(data)));
+    assert(ring.TryPush(nullptr, "second %lu", 2, 20, nullptr, 0));
+
+    TraceRecord record;
+    assert(ring.TryPop(record));
+    assert(record.arg == 1 && record.timestamp == 10);
+    assert(record.GetDataSize() == 3 && record.data[2] == 0x03);
+    assert(ring.TryPop(record));
+    assert(record.arg == 2 && record.GetDataSize() == 0);
+    assert(!ring.TryPop(record));
+  }
+  // A full ring drops records until the consumer catches up
+  {
+    TraceRing<2> ring;
+    assert(ring.TryPush(nullptr, "", 1, 0, nullptr, 0));
+    assert(ring.TryPush(nullptr, "", 2, 0, nullptr, 0));
+    assert(!ring.TryPush(nullptr, "", 3, 0, nullptr, 0));
+
+    TraceRecord record;
+    assert(ring.TryPop(record) && record.arg == 1);
+    assert(ring.TryPush(nullptr, "", 4, 0, nullptr, 0));
+    assert(ring.TryPop(record) && record.arg == 2);
+    assert(ring.TryPop(record) && record.arg == 4);
+  }
+  // Long data is truncated, its size is kept
+  {
+    TraceRing<2> ring;
+    uint8_t data[100] = {};
+    assert(ring.TryPush(nullptr, "", 0, 0, data, sizeof(data)));
+
+    TraceRecord record;
+    assert(ring.TryPop(record));
+    assert(record.size == 100);
+    assert(record.GetDataSize() == TraceRecord::max_data_size);
+  }
+  // Concurrent producers neither lose nor duplicate records
+  {
+    constexpr uint32_t producers = 4;
+    constexpr uint32_t records_per_producer = 10000;
+    TraceRing<64> ring;
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; p++) {
+      threads.emplace_back([&ring, p]() {
+        for (uint32_t i = 0; i < records_per_producer; i++) {
+          auto arg = p * records_per_producer + i;
+          auto data = reinterpret_cast<const uint8_t *>(&arg);
+          while (!ring.TryPush(nullptr, "", arg, 0, data, sizeof(arg))) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    std::vector<uint32_t> next(producers, 0);
+    TraceRecord record;
+    for (uint32_t popped = 0; popped < producers * records_per_producer;) {
+      if (!ring.TryPop(record)) continue;
+      uint32_t data;
+      memcpy(&data, record.data, sizeof(data));
+      assert(data == record.arg);
+      // Records of one producer keep their order.
+      auto producer = record.arg / records_per_producer;
+      assert(record.arg % records_per_producer == next[producer]);
+      next[producer]++;
+      popped++;
+    }
+    assert(!ring.TryPop(record));
+
+    for (auto &thread : threads) thread.join();
+  }
+}
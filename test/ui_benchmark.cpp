@@ -0,0 +1,189 @@
+// Renders the UI on the host, against FramebufferDisplay and a fake buzzer
+// and LED strip, while replaying a scripted sequence of terminal states.
+// Reports per step of the script the LVGL wake-ups, the rendered frames with
+// their render time and flushed bytes, and the LVGL heap use.
+//
+// Usage: ui_benchmark [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "common/uid_set.h"
+#include "host/framebuffer_display.h"
+#include "ui/feedback.h"
+#include "ui/state_binding.h"
+#include "ui/statusscreen.h"
+
+using oww::state::ConfigSnapshot;
+using namespace oww::state::terminal;
+using namespace oww::ui;
+
+namespace {
+
+// Simulated time, advanced by the benchmark instead of waiting.
+uint32_t now_ms = 0;
+
+class FakeFeedbackSink : public FeedbackSink {
+ public:
+  size_t buzzes = 0;
+  size_t animations = 0;
+
+  virtual void Buzz(int frequency, uint32_t duration_ms) override {
+    buzzes++;
+  }
+  virtual void SetLedAnimation(const LedAnimation &animation) override {
+    animations++;
+  }
+};
+
+struct Step {
+  const char *name;
+  std::shared_ptr<State> state;
+  // Simulated time the state is shown.
+  uint32_t duration_ms;
+};
+
+struct StepStats {
+  size_t wakeups = 0;
+  size_t frames = 0;
+  uint64_t render_us = 0;
+  uint32_t render_max_us = 0;
+  uint64_t flushed_bytes = 0;
+  size_t heap_used = 0;
+  size_t heap_max_used = 0;
+};
+
+constexpr TagUid tag_uid = {0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+
+std::shared_ptr<State> MakeStartSession(start::State nested) {
+  return std::make_shared<State>(StartSession{
+      .tag_uid = tag_uid,
+      .state = std::make_shared<start::State>(std::move(nested)),
+  });
+}
+
+std::shared_ptr<State> MakePersonalize(personalize::State nested) {
+  return std::make_shared<State>(Personalize{
+      .tag_uid = tag_uid,
+      .state = std::make_shared<personalize::State>(std::move(nested)),
+  });
+}
+
+// A tap starting a session, an unknown card, and a personalization.
+std::vector<Step> MakeScript() {
+  return {
+      {"idle", std::make_shared<State>(Idle{}), 2000},
+      {"detected", std::make_shared<State>(Detected{}), 200},
+      {"authenticated",
+       std::make_shared<State>(Authenticated{.tag_uid = tag_uid}), 200},
+      {"start: await response",
+       MakeStartSession(start::AwaitStartSessionResponse{.response = nullptr}),
+       500},
+      {"start: succeeded",
+       MakeStartSession(start::Succeeded{.session_id = "session"}), 1000},
+      {"idle", std::make_shared<State>(Idle{}), 2000},
+      {"unknown", std::make_shared<State>(Unknown{}), 1000},
+      {"idle", std::make_shared<State>(Idle{}), 2000},
+      {"personalize: wait", MakePersonalize(personalize::Wait{}), 200},
+      {"personalize: tag", MakePersonalize(personalize::DoPersonalizeTag{}),
+       500},
+      {"personalize: done", MakePersonalize(personalize::Completed{}), 1000},
+      {"idle", std::make_shared<State>(Idle{}), 2000},
+  };
+}
+
+// Runs LVGL like UserInterface::UserInterfaceThread for the duration of the
+// step, skipping the time LVGL would sleep.
+void RunStep(const Step &step, StateBinding &binding,
+             FramebufferDisplay &display, StepStats &stats) {
+  binding.SetTerminalState(step.state);
+
+  auto end = now_ms + step.duration_ms;
+  while (static_cast<int32_t>(end - now_ms) > 0) {
+    auto start = std::chrono::steady_clock::now();
+    uint32_t time_till_next = lv_timer_handler();
+    uint32_t render_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+    stats.wakeups++;
+    if (auto flushed = display.TakeFlushedBytes(); flushed > 0) {
+      stats.frames++;
+      stats.render_us += render_us;
+      stats.render_max_us = std::max(stats.render_max_us, render_us);
+      stats.flushed_bytes += flushed;
+    }
+
+    // At least 1 ms, in case LVGL has timers due right away.
+    now_ms += std::max<uint32_t>(std::min(time_till_next, end - now_ms), 1);
+  }
+
+  lv_mem_monitor_t monitor;
+  lv_mem_monitor(&monitor);
+  stats.heap_used = std::max(stats.heap_used,
+                             monitor.total_size - monitor.free_size);
+  stats.heap_max_used = std::max(stats.heap_max_used, monitor.max_used);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 10;
+
+  lv_init();
+  lv_tick_set_cb([]() { return now_ms; });
+
+  FramebufferDisplay display(config::ui::display::resolution_horizontal,
+                             config::ui::display::resolution_vertical);
+  FakeFeedbackSink feedback_sink;
+
+  auto script = MakeScript();
+  std::vector<StepStats> stats(script.size());
+  {
+    StateBinding binding(std::make_shared<State>(Idle{}),
+                         std::make_shared<const ConfigSnapshot>());
+    Feedback feedback(binding, feedback_sink);
+    StatusScreen screen(lv_screen_active(), binding);
+
+    for (int i = 0; i < iterations; i++) {
+      for (size_t s = 0; s < script.size(); s++) {
+        RunStep(script[s], binding, display, stats[s]);
+      }
+    }
+  }
+
+  printf("%-24s %8s %7s %9s %9s %10s %9s %9s\n", "step", "wakeups", "frames",
+         "avg us", "max us", "avg bytes", "heap", "heap max");
+
+  StepStats total;
+  for (size_t s = 0; s < script.size(); s++) {
+    auto &step = stats[s];
+    auto frames = std::max<size_t>(step.frames, 1);
+    printf("%-24s %8zu %7zu %9llu %9u %10llu %9zu %9zu\n", script[s].name,
+           step.wakeups / iterations, step.frames / iterations,
+           (unsigned long long)(step.render_us / frames), step.render_max_us,
+           (unsigned long long)(step.flushed_bytes / frames), step.heap_used,
+           step.heap_max_used);
+
+    total.wakeups += step.wakeups;
+    total.frames += step.frames;
+    total.render_us += step.render_us;
+    total.render_max_us = std::max(total.render_max_us, step.render_max_us);
+    total.flushed_bytes += step.flushed_bytes;
+  }
+
+  auto frames = std::max<size_t>(total.frames, 1);
+  printf("total: %zu wakeups, %zu frames, render avg %llu us, max %u us, "
+         "flushed avg %llu bytes per frame\n",
+         total.wakeups / iterations, total.frames / iterations,
+         (unsigned long long)(total.render_us / frames), total.render_max_us,
+         (unsigned long long)(total.flushed_bytes / frames));
+  printf("feedback: %zu tones, %zu LED animations\n",
+         feedback_sink.buzzes / iterations,
+         feedback_sink.animations / iterations);
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include "common/uid_set.h"
+
+#include <cassert>
+#include <cstdio>
+
+TagUid MakeUid(uint8_t last_byte) {
+  return {0x04, 0x11, 0x22, 0x33, 0x44, 0x55, last_byte};
+}
+
+int main(int argc, char *argv[]) {
+  // SortedUidSet finds all inserted UIDs
+  {
+    SortedUidSet set({MakeUid(3), MakeUid(1), MakeUid(2)});
+
+    assert(set.size() == 3);
+    assert(set.Contains(MakeUid(1)));
+    assert(set.Contains(MakeUid(2)));
+    assert(set.Contains(MakeUid(3)));
+    assert(!set.Contains(MakeUid(4)));
+  }
+  // SortedUidSet drops duplicates
+  {
+    SortedUidSet set({MakeUid(1), MakeUid(1)});
+
+    assert(set.size() == 1);
+    assert(set.Contains(MakeUid(1)));
+  }
+  // SortedUidSet empty
+  {
+    SortedUidSet set;
+
+    assert(!set.Contains(MakeUid(1)));
+  }
+  // UidBloomFilter has no false negatives
+  {
+    UidBloomFilter<1024, 4> filter;
+    for (int i = 0; i < 100; i++) filter.Add(MakeUid(i));
+
+    for (int i = 0; i < 100; i++) assert(filter.MayContain(MakeUid(i)));
+  }
+  // UidBloomFilter rejects most unknown UIDs
+  {
+    UidBloomFilter<1024, 4> filter;
+    for (int i = 0; i < 100; i++) filter.Add(MakeUid(i));
+
+    int false_positives = 0;
+    for (int i = 100; i < 256; i++) {
+      if (filter.MayContain(MakeUid(i))) false_positives++;
+    }
+    printf("bloom filter false positives: %d/156\n", false_positives);
+
+    assert(false_positives < 16);
+  }
+}
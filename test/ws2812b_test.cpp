@@ -0,0 +1,91 @@
+#include "ui/driver/ws2812b.h"
+
+#include <cassert>
+#include <vector>
+
+using oww::ui::LedColor;
+
+// Line level per SPI bit, MSB first.
+std::vector<bool> ToWaveform(const uint8_t *data, size_t size) {
+  std::vector<bool> levels;
+  for (size_t i = 0; i < size; i++) {
+    for (uint8_t bit = 0x80; bit != 0; bit >>= 1) {
+      levels.push_back(data[i] & bit);
+    }
+  }
+  return levels;
+}
+
+// Decodes the waveform the way a WS2812B samples it: each rising edge starts
+// a data bit, which is a 1 if the line is still high after 625 ns. Checks
+// the high and low times of every bit against the datasheet.
+std::vector<uint8_t> Decode(const std::vector<bool> &levels) {
+  std::vector<uint8_t> bytes;
+  uint8_t value = 0;
+  int bits = 0;
+
+  size_t i = 0;
+  while (i < levels.size()) {
+    assert(levels[i]);
+    size_t high = 0, low = 0;
+    while (i < levels.size() && levels[i]) high++, i++;
+    while (i < levels.size() && !levels[i]) low++, i++;
+
+    uint32_t high_ns = high * ws2812b::spi_bit_ns;
+    uint32_t low_ns = low * ws2812b::spi_bit_ns;
+    bool one = high_ns > 625;
+    if (one) {
+      assert(high_ns >= 650 && high_ns <= 950);
+      assert(low_ns >= 300 && low_ns <= 600);
+    } else {
+      assert(high_ns >= 250 && high_ns <= 550);
+      assert(low_ns >= 700 && low_ns <= 1000);
+    }
+
+    value = (value << 1) | one;
+    if (++bits == 8) {
+      bytes.push_back(value);
+      value = 0;
+      bits = 0;
+    }
+  }
+  assert(bits == 0);
+  return bytes;
+}
+
+int main(int argc, char *argv[]) {
+  // Codes of a 0 and a 1 bit
+  {
+    uint8_t out[ws2812b::pixel_size];
+    auto end = ws2812b::Encode(LedColor{.r = 0, .g = 0x80, .b = 0x01}, out);
+    assert(end == out + ws2812b::pixel_size);
+
+    // Green first, MSB first.
+    assert(out[0] == ws2812b::code_1);
+    assert(out[1] == ws2812b::code_0);
+    assert(out[7] == ws2812b::code_0);
+    // Blue last.
+    assert(out[22] == ws2812b::code_0);
+    assert(out[23] == ws2812b::code_1);
+  }
+  // Pixels decode to their GRB bytes, with every bit within the timing
+  {
+    const LedColor pixels[] = {
+        {.r = 0xff, .g = 0x00, .b = 0x55},
+        {.r = 0x12, .g = 0xff, .b = 0xa0},
+        {.r = 0x00, .g = 0x00, .b = 0x00},
+    };
+    uint8_t buffer[std::size(pixels) * ws2812b::pixel_size];
+    auto out = buffer;
+    for (auto &pixel : pixels) out = ws2812b::Encode(pixel, out);
+
+    auto bytes = Decode(ToWaveform(buffer, sizeof(buffer)));
+    const std::vector<uint8_t> expected = {0x00, 0xff, 0x55, 0xff, 0x12,
+                                           0xa0, 0x00, 0x00, 0x00};
+    assert(bytes == expected);
+  }
+  // The reset time before a frame
+  {
+    assert(ws2812b::reset_size * 8 * ws2812b::spi_bit_ns >= 280 * 1000);
+  }
+}
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Converts a PNG into an RLE compressed RGB565 image for the UI.
+
+The output is shipped as a Particle OTA asset (see assetOtaDir in
+project.properties) and decoded on the device by ui/asset/rle_image_decoder.
+
+Format, little endian:
+  header: magic "RLEI", version (u8) = 1, color format (u8) = LVGL's
+          LV_COLOR_FORMAT_RGB565, width (u16), height (u16), reserved (u16),
+          size of the packets (u32)
+  packets: a control byte c, followed by
+           - c & 0x80: a single pixel, repeated (c & 0x7f) + 1 times
+           - otherwise: c + 1 literal pixels
+
+Only 8 bit, non-interlaced RGB and RGBA PNGs are supported. Transparent
+pixels are blended onto the background color.
+
+Usage: rle_image.py input.png output.rle [--background rrggbb]
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"RLEI"
+VERSION = 1
+LV_COLOR_FORMAT_RGB565 = 0x12
+MAX_PACKET = 128
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path} is not a PNG")
+
+    pos = 8
+    idat = b""
+    while pos < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        if chunk_type == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(
+                ">IIBBBBB", chunk)
+        elif chunk_type == b"IDAT":
+            idat += chunk
+        pos += 12 + length
+
+    if depth != 8 or color_type not in (2, 6) or interlace != 0:
+        sys.exit(f"{path}: only 8 bit, non-interlaced RGB(A) is supported")
+
+    channels = 4 if color_type == 6 else 3
+    stride = width * channels
+    raw = zlib.decompress(idat)
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        offset = y * (stride + 1)
+        filter_type = raw[offset]
+        row = bytearray(raw[offset + 1:offset + 1 + stride])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            up_left = previous[i - channels] if i >= channels else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif filter_type == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xff
+            elif filter_type == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                predictor = (left if pa <= pb and pa <= pc else
+                             up if pb <= pc else up_left)
+                row[i] = (row[i] + predictor) & 0xff
+        rows.append(row)
+        previous = row
+
+    return width, height, channels, rows
+
+
+def to_rgb565(width, channels, rows, background):
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            r, g, b = row[x * channels:x * channels + 3]
+            if channels == 4:
+                a = row[x * channels + 3]
+                r, g, b = (
+                    (c * a + bg * (255 - a) + 127) // 255
+                    for c, bg in zip((r, g, b), background))
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return pixels
+
+
+def encode(pixels):
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_PACKET]
+            del literals[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for pixel in chunk:
+                out.extend(struct.pack("<H", pixel))
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while (i + run < len(pixels) and run < MAX_PACKET and
+               pixels[i + run] == pixels[i]):
+            run += 1
+        # A run of 2 costs as much as 2 literals, but ends the literal packet.
+        if run >= 3:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(struct.pack("<H", pixels[i]))
+            i += run
+        else:
+            literals.append(pixels[i])
+            i += 1
+    flush_literals()
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input")
+    parser.add_argument("output")
+    parser.add_argument("--background", default="ffffff",
+                        help="color transparent pixels are blended onto")
+    args = parser.parse_args()
+
+    background = bytes.fromhex(args.background)
+    width, height, channels, rows = read_png(args.input)
+    packets = encode(to_rgb565(width, channels, rows, background))
+
+    with open(args.output, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<BBHHHI", VERSION, LV_COLOR_FORMAT_RGB565, width,
+                            height, 0, len(packets)))
+        f.write(packets)
+
+    raw_size = width * height * 2
+    print(f"{args.output}: {width}x{height}, {len(packets)} bytes "
+          f"({100 * len(packets) / raw_size:.0f}% of {raw_size})")
+
+
+if __name__ == "__main__":
+    main()